@@ -537,6 +537,16 @@ void TIM8_UP_TIM13_IRQHandler(void) {
         /*这里触发软中断进入 ControlLoop_IRQHandler 中断函数，
         底层控制都是在这个函数中完成的*/
         NVIC->STIR = ControlLoop_IRQn;
+
+        // The timings of the last control loop were just latched. With double
+        // PWM updates, the next timer update interval gets its own timings,
+        // rotated to the phase at the center of that interval.
+        if (odrv.config_.enable_double_pwm_update) {
+            motors[0].pwm_mid_update_cb(timestamp_ + 3 * TIM_1_8_PERIOD_CLOCKS *
+                (TIM_1_8_RCR + 1) / 2 - TIM1_INIT_COUNT);
+            motors[1].pwm_mid_update_cb(timestamp_ + 3 * TIM_1_8_PERIOD_CLOCKS *
+                (TIM_1_8_RCR + 1) / 2);
+        }
     } else {
         // Tentatively reset all PWM outputs to 50% duty cycles. 
         // If the control loop handler finishes in time then these 
@@ -617,11 +627,15 @@ void ControlLoop_IRQHandler(void) {
     motors[1].dc_calib_cb(timestamp + TIM_1_8_PERIOD_CLOCKS * 
         (TIM_1_8_RCR + 1), current1);
 
+    // The timings are applied for the next two timer update intervals, or
+    // only for the first one if the TIM8 handler updates them again in between.
+    uint32_t pwm_delay = odrv.config_.enable_double_pwm_update
+                       ? 5 * TIM_1_8_PERIOD_CLOCKS * (TIM_1_8_RCR + 1) / 2
+                       : 3 * TIM_1_8_PERIOD_CLOCKS * (TIM_1_8_RCR + 1);
+
     /*内部调用基础电压矢量控制（SVM 状态机）更新合成矢量驱动定向电流输出*/
-    motors[0].pwm_update_cb(timestamp + 3 * TIM_1_8_PERIOD_CLOCKS * 
-        (TIM_1_8_RCR + 1) - TIM1_INIT_COUNT);
-    motors[1].pwm_update_cb(timestamp + 3 * TIM_1_8_PERIOD_CLOCKS * 
-        (TIM_1_8_RCR + 1));
+    motors[0].pwm_update_cb(timestamp + pwm_delay - TIM1_INIT_COUNT);
+    motors[1].pwm_update_cb(timestamp + pwm_delay);
 
     // If we did everything right, the TIM8 update handler should have been
     // called exactly once between the start of this function and now.
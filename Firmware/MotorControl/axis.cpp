@@ -39,7 +39,9 @@ Axis::Axis(int axis_num,
     trap_traj_.axis_ = this;
     min_endstop_.axis_ = this;
     max_endstop_.axis_ = this;
+    probe_.axis_ = this;
     mechanical_brake_.axis_ = this;
+    position_compare_.axis_ = this;
 }
 
 Axis::LockinConfig_t Axis::default_calibration() {
@@ -281,6 +283,7 @@ bool Axis::start_closed_loop_control() {
     CRITICAL_SECTION() {
         if (sensorless_mode) {
             controller_.pos_estimate_linear_src_.disconnect();
+            controller_.pos_estimate_linear_split_src_.disconnect();
             controller_.pos_estimate_circular_src_.disconnect();
             controller_.pos_wrap_src_.disconnect();
             controller_.vel_estimate_src_.connect_to(&sensorless_estimator_.vel_estimate_);
@@ -289,10 +292,12 @@ bool Axis::start_closed_loop_control() {
             controller_.pos_estimate_circular_src_.connect_to(&ax->encoder_.pos_circular_);
             controller_.pos_wrap_src_.connect_to(&controller_.config_.circular_setpoint_range);
             controller_.pos_estimate_linear_src_.connect_to(&ax->encoder_.pos_estimate_);
+            controller_.pos_estimate_linear_split_src_.connect_to(&ax->encoder_.pos_estimate_split_);
             controller_.vel_estimate_src_.connect_to(&ax->encoder_.vel_estimate_);
         } else {
             controller_.pos_estimate_circular_src_.disconnect();
             controller_.pos_estimate_linear_src_.disconnect();
+            controller_.pos_estimate_linear_split_src_.disconnect();
             controller_.pos_wrap_src_.disconnect();
             controller_.vel_estimate_src_.disconnect();
             /*出现该错误说明电机其余配置正常，但编码器校准参数没有被保存到 Flash，或启动时未读取到编码器校准参数*/
@@ -365,25 +370,17 @@ bool Axis::run_closed_loop_control_loop() {
 }
 
 
-// Slowly drive in the negative direction at homing_speed until the min endstop is pressed
-// When pressed, set the linear count to the offset (default 0), and then go to position 0
-bool Axis::run_homing() {
-    // TODO: theoretically this check should be inside the update loop,
-    // otherwise someone could disable the endstop while homing is in progress.
-    if (!min_endstop_.config_.enabled) {
-        return error_ |= ERROR_HOMING_WITHOUT_ENDSTOP, false;
-    }
-
+// Drives toward the min endstop at vel until it is pressed.
+// The motor is disarmed when this returns.
+bool Axis::run_homing_approach(float vel) {
     controller_.config_.control_mode = Controller::CONTROL_MODE_VELOCITY_CONTROL;
     controller_.config_.input_mode = Controller::INPUT_MODE_VEL_RAMP;
 
     controller_.input_pos_ = 0.0f;
     controller_.input_pos_updated();
-    controller_.input_vel_ = -controller_.config_.homing_speed;
+    controller_.input_vel_ = vel;
     controller_.input_torque_ = 0.0f;
 
-    homing_.is_homed = false;
-
     error_ &= ~ERROR_MIN_ENDSTOP_PRESSED;
 
     bool done = false;
@@ -399,24 +396,27 @@ bool Axis::run_homing() {
     
     controller_.input_vel_ = 0.0f;
 
-    if (!done) {
-        return false;
+    if (done) {
+        error_ &= ~ERROR_MIN_ENDSTOP_PRESSED; // clear this error since we deliberately drove into the endstop
     }
+    return done;
+}
 
-    error_ &= ~ERROR_MIN_ENDSTOP_PRESSED; // clear this error since we deliberately drove into the endstop
-
+// Moves to pos with the trapezoidal planner, starting from standstill.
+// The motor is left armed if the move completes.
+bool Axis::run_homing_move(float pos) {
     std::optional<float> pos_estimate_local = encoder_.pos_estimate_.any();
     if (pos_estimate_local == std::nullopt || !pos_estimate_local.has_value()){
         return error_ |= ERROR_UNKNOWN_POSITION, false;
     }
-    
+
     controller_.config_.control_mode = Controller::CONTROL_MODE_POSITION_CONTROL;
     controller_.config_.input_mode = Controller::INPUT_MODE_TRAP_TRAJ;
 
     // Initialize closed loop control, and then set the desired location.
     start_closed_loop_control();
     
-    controller_.input_pos_ = pos_estimate_local.value() + min_endstop_.config_.offset;
+    controller_.input_pos_ = pos;
     controller_.pos_setpoint_ = pos_estimate_local.value();
     controller_.vel_setpoint_ = 0.0f;
     controller_.input_pos_updated();
@@ -425,10 +425,76 @@ bool Axis::run_homing() {
     // the controller has time to run move_to_pos() on the next update()
     controller_.trajectory_done_ = false; 
     
+    bool done = false;
     while ((requested_state_ == AXIS_STATE_UNDEFINED) && motor_.is_armed_ && !(done = controller_.trajectory_done_)) {
         osDelay(1);
     }
 
+    return done;
+}
+
+// Drive in the negative direction at homing_speed until the min endstop is pressed.
+// If homing_fast_speed is faster, the endstop is first found at homing_fast_speed,
+// then the axis backs off by homing_backoff_distance and re-approaches at homing_speed.
+// The position latched at the endstop edge of the last approach is the reference:
+// the axis moves to that position plus the endstop offset, which becomes position 0.
+bool Axis::run_homing() {
+    // TODO: theoretically this check should be inside the update loop,
+    // otherwise someone could disable the endstop while homing is in progress.
+    if (!min_endstop_.config_.enabled) {
+        return error_ |= ERROR_HOMING_WITHOUT_ENDSTOP, false;
+    }
+
+    homing_.is_homed = false;
+
+    const float homing_speed = controller_.config_.homing_speed;
+    const float fast_speed = std::copysign(controller_.config_.homing_fast_speed, homing_speed);
+
+    if (std::abs(fast_speed) > std::abs(homing_speed)) {
+        if (!run_homing_approach(-fast_speed)) {
+            return false;
+        }
+
+        std::optional<float> pos_estimate_local = encoder_.pos_estimate_.any();
+        if (pos_estimate_local == std::nullopt || !pos_estimate_local.has_value()){
+            return error_ |= ERROR_UNKNOWN_POSITION, false;
+        }
+
+        // Back off, away from the endstop
+        float backoff = std::copysign(controller_.config_.homing_backoff_distance, homing_speed);
+        bool done = run_homing_move(pos_estimate_local.value() + backoff);
+        if (done) {
+            // Give the endstop time to debounce its release
+            osDelay(min_endstop_.config_.debounce_ms + 1);
+        }
+        stop_closed_loop_control();
+
+        if (!done) {
+            return false;
+        }
+        if (min_endstop_.get_state()) {
+            // homing_backoff_distance is too short to release the endstop
+            return error_ |= ERROR_MIN_ENDSTOP_PRESSED, false;
+        }
+    }
+
+    min_endstop_.arm_latch();
+
+    if (!run_homing_approach(-homing_speed)) {
+        return false;
+    }
+
+    std::optional<float> pos_estimate_local = encoder_.pos_estimate_.any();
+    if (pos_estimate_local == std::nullopt || !pos_estimate_local.has_value()){
+        return error_ |= ERROR_UNKNOWN_POSITION, false;
+    }
+
+    // The endstop position latched at the edge does not depend on the
+    // debounce time or on how far the axis overshot while stopping
+    float endstop_pos = min_endstop_.latched_ ? min_endstop_.latch_pos_ : pos_estimate_local.value();
+
+    bool done = run_homing_move(endstop_pos + min_endstop_.config_.offset);
+
     stop_closed_loop_control();
 
     if (!done) {
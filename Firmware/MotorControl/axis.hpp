@@ -11,6 +11,7 @@ class Axis;
 #include "trapTraj.hpp"
 #include "endstop.hpp"
 #include "mechanical_brake.hpp"
+#include "position_compare.hpp"
 #include "low_level.h"
 #include "utils.hpp"
 #include "task_timer.hpp"
@@ -160,6 +161,8 @@ public:
     bool run_lockin_spin(const LockinConfig_t &lockin_config, bool remain_armed,
                 std::function<bool(bool)> loop_cb = {} );
     bool run_closed_loop_control_loop();
+    bool run_homing_approach(float vel);
+    bool run_homing_move(float pos);
     bool run_homing();
     bool run_idle_loop();
 
@@ -185,7 +188,9 @@ public:
     TrapezoidalTrajectory& trap_traj_;
     Endstop& min_endstop_;
     Endstop& max_endstop_;
+    Endstop probe_; // touch probe input, only used through its latch
     MechanicalBrake& mechanical_brake_;
+    PositionCompare position_compare_;
     TaskTimes task_times_;
 
     osThreadId thread_id_ = 0;
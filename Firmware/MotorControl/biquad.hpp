@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cmath>
+
+// Second order IIR section (transposed direct form II).
+// Coefficients follow the RBJ audio EQ cookbook and are meant to be computed
+// once on configuration change. update() is cheap enough to run every
+// control loop iteration.
+class Biquad {
+   public:
+    enum Type {
+        TYPE_NONE = 0,      // passthrough
+        TYPE_LOWPASS = 1,
+        TYPE_NOTCH = 2,
+    };
+
+    // @param frequency: corner or notch frequency [Hz]
+    // @param q: quality factor. For a notch this is frequency / bandwidth.
+    // @param sample_rate: rate at which update() is called [Hz]
+    // Falls back to passthrough if the parameters are out of range.
+    void configure(Type type, float frequency, float q, float sample_rate) {
+        if (type == TYPE_NONE || !(frequency > 0.0f) || !(q > 0.0f) || !(frequency < 0.45f * sample_rate)) {
+            b0_ = 1.0f;
+            b1_ = b2_ = a1_ = a2_ = 0.0f;
+            return;
+        }
+
+        float w0 = 2.0f * static_cast<float>(M_PI) * frequency / sample_rate;
+        float cos_w0 = std::cos(w0);
+        float alpha = std::sin(w0) / (2.0f * q);
+        float a0 = 1.0f + alpha;
+
+        if (type == TYPE_LOWPASS) {
+            b0_ = 0.5f * (1.0f - cos_w0) / a0;
+            b1_ = (1.0f - cos_w0) / a0;
+            b2_ = b0_;
+        } else {
+            b0_ = 1.0f / a0;
+            b1_ = -2.0f * cos_w0 / a0;
+            b2_ = b0_;
+        }
+        a1_ = -2.0f * cos_w0 / a0;
+        a2_ = (1.0f - alpha) / a0;
+    }
+
+    float update(float x) {
+        float y = b0_ * x + z1_;
+        z1_ = b1_ * x - a1_ * y + z2_;
+        z2_ = b2_ * x - a2_ * y;
+        return y;
+    }
+
+    void reset() {
+        z1_ = 0.0f;
+        z2_ = 0.0f;
+    }
+
+   private:
+    float b0_ = 1.0f, b1_ = 0.0f, b2_ = 0.0f;  // numerator
+    float a1_ = 0.0f, a2_ = 0.0f;              // denominator (a0 normalized to 1)
+    float z1_ = 0.0f, z2_ = 0.0f;              // state
+};
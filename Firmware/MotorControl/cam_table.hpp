@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// Periodic cam profile sampled at evenly spaced master positions.
+// Point i is the slave position at master position i * period / num_points.
+// After every master period the profile repeats, shifted by rise (0 for a
+// closed cam, non-zero for e.g. a flying knife that advances every cycle).
+// The profile is interpolated with a Catmull-Rom spline, so the slope used as
+// velocity feed-forward is continuous across the table points.
+class CamTable {
+   public:
+    struct Output {
+        float pos;    // slave position
+        float slope;  // d(slave position) / d(master position)
+    };
+
+    // @param points: slave positions, num_points >= 2 entries
+    // @param period: master travel covered by one table cycle (> 0)
+    // @param rise: slave travel per table cycle
+    // @param master: master position
+    static Output eval(const float* points, size_t num_points, float period, float rise, float master) {
+        const int32_t n = (int32_t)num_points;
+        float u = master / period * (float)n;
+        float i_float = std::floor(u);
+        float t = u - i_float;
+        int32_t i = (int32_t)i_float;
+        int32_t cycle = floor_div(i, n);
+        int32_t j = i - cycle * n;
+
+        // Neighbouring points, relative to the current cycle
+        float p0 = point(points, n, rise, j - 1);
+        float p1 = point(points, n, rise, j);
+        float p2 = point(points, n, rise, j + 1);
+        float p3 = point(points, n, rise, j + 2);
+
+        float a = p2 - p0;
+        float b = 2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3;
+        float c = 3.0f * (p1 - p2) + p3 - p0;
+
+        Output out;
+        out.pos = (float)cycle * rise + p1 + 0.5f * t * (a + t * (b + t * c));
+        out.slope = 0.5f * (a + t * (2.0f * b + t * 3.0f * c)) * (float)n / period;
+        return out;
+    }
+
+   private:
+    static int32_t floor_div(int32_t x, int32_t y) {
+        int32_t q = x / y;
+        return (x - q * y < 0) ? q - 1 : q;
+    }
+
+    static float point(const float* points, int32_t n, float rise, int32_t k) {
+        int32_t cycle = floor_div(k, n);
+        return points[k - cycle * n] + (float)cycle * rise;
+    }
+};
@@ -5,7 +5,12 @@
 
 bool Controller::apply_config() {
     config_.parent = this;
+    for (auto& vel_filter: config_.vel_filters) {
+        vel_filter.parent = this;
+    }
     update_filter_gains();
+    update_vel_filters();
+    update_input_shaper();
     return true;
 }
 
@@ -16,6 +21,12 @@ void Controller::reset() {
     torque_setpoint_ = 0.0f;
     mechanical_power_ = 0.0f;
     electrical_power_ = 0.0f;
+    for (auto& vel_filter: vel_filters_) {
+        vel_filter.reset();
+    }
+    disturbance_observer_state_ = 0.0f;
+    load_torque_estimate_ = 0.0f;
+    last_torque_ = 0.0f;
 }
 
 void Controller::set_error(Error error) {
@@ -29,12 +40,16 @@ void Controller::set_error(Error error) {
 
 /**规划梯形加减速运动轨迹，这个函数会使用梯形速度轨迹（Trapezoidal Trajectory）规划器，
  * 从当前位置移动到目标点 goal_point，并设置状态让控制器开始执行轨迹。*/
-void Controller::move_to_pos(float goal_point) {
-    axis_->trap_traj_.planTrapezoidal(goal_point, pos_setpoint_, vel_setpoint_,
+void Controller::move_to_pos(SplitPosition goal_point) {
+    // Plan relative to the current setpoint so that the trajectory keeps its
+    // resolution far away from zero
+    trajectory_origin_ = pos_setpoint_split_;
+    axis_->trap_traj_.planTrapezoidal(goal_point - trajectory_origin_, 0.0f, vel_setpoint_,
                                  axis_->trap_traj_.config_.vel_limit,
                                  axis_->trap_traj_.config_.accel_limit,
                                  axis_->trap_traj_.config_.decel_limit);
     axis_->trap_traj_.t_ = 0.0f;
+    trajectory_settle_ticks_ = 0;
     trajectory_done_ = false;
 }
 
@@ -43,10 +58,14 @@ void Controller::move_to_pos(float goal_point) {
  * 增量移动一个 displacement 距离，然后调用 input_pos_updated()，
  * 让控制器根据新的目标位置，开始执行新的轨迹或控制过程。*/
 void Controller::move_incremental(float displacement, bool from_input_pos = true){
-    if(from_input_pos){
-        input_pos_ += displacement;
-    } else{
-        input_pos_ = pos_setpoint_ + displacement;
+    CRITICAL_SECTION() {
+        sync_split_positions();
+        if(from_input_pos){
+            input_pos_split_ += displacement;
+        } else{
+            input_pos_split_ = pos_setpoint_split_ + displacement;
+        }
+        input_pos_ = input_pos_published_ = input_pos_split_.to_float();
     }
 
     input_pos_updated();
@@ -118,6 +137,416 @@ bool Controller::anticogging_calibration(float pos_estimate, float vel_estimate)
     }
 }
 
+/**
+ * @brief Starts identifying inertia and friction of the axis.
+ * 
+ * The plant is excited with the INPUT_MODE_TUNING sinusoid as configured in
+ * autotuning_ (frequency and amplitudes) for identification_duration seconds.
+ * The commanded torque and the velocity estimate are then fitted to
+ * T = J*a + b*v + Tc*sign(v) by least squares.
+ * 
+ * Once finished, gain_identification_.valid indicates success and
+ * apply_identified_gains() can be used to set the controller gains.
+ * The axis must be in closed loop control.
+ */
+bool Controller::start_gain_identification() {
+    if (axis_->current_state_ != Axis::AXIS_STATE_CLOSED_LOOP_CONTROL
+        || autotuning_.frequency <= 0.0f || autotuning_.identification_duration <= 0.0f
+        || frequency_response_.active) {
+        return false;
+    }
+
+    GainIdentification_t& id = gain_identification_;
+    id = GainIdentification_t{};
+    id.prev_input_mode = config_.input_mode;
+    // Filter well above the excitation frequency but within the loop rate
+    float bandwidth = std::min(20.0f * M_PI * autotuning_.frequency, 0.25f * current_meas_hz);
+    id.filter_k = std::min(bandwidth * current_meas_period, 1.0f);
+    std::fill(std::begin(id.phi_phi), std::end(id.phi_phi), 0.0f);
+    std::fill(std::begin(id.phi_torque), std::end(id.phi_torque), 0.0f);
+
+    autotuning_phase_ = 0.0f;
+    config_.input_mode = INPUT_MODE_TUNING;
+    id.active = true;
+    return true;
+}
+
+// Solves the symmetric 3x3 system A*x = b where A is given as upper triangle
+// {a00, a01, a02, a11, a12, a22}. Returns false if A is (close to) singular.
+static bool solve_sym3x3(const float A[6], const float b[3], float x[3]) {
+    float a00 = A[0], a01 = A[1], a02 = A[2], a11 = A[3], a12 = A[4], a22 = A[5];
+    float c00 = a11 * a22 - a12 * a12;
+    float c01 = a02 * a12 - a01 * a22;
+    float c02 = a01 * a12 - a02 * a11;
+    float det = a00 * c00 + a01 * c01 + a02 * c02;
+    if (!(std::abs(det) > 1e-12f * std::abs(a00 * a11 * a22))) {
+        return false;
+    }
+    float c11 = a00 * a22 - a02 * a02;
+    float c12 = a01 * a02 - a00 * a12;
+    float c22 = a00 * a11 - a01 * a01;
+    x[0] = (c00 * b[0] + c01 * b[1] + c02 * b[2]) / det;
+    x[1] = (c01 * b[0] + c11 * b[1] + c12 * b[2]) / det;
+    x[2] = (c02 * b[0] + c12 * b[1] + c22 * b[2]) / det;
+    return true;
+}
+
+/**
+ * @brief Accumulates one sample for gain identification. Called from update().
+ * @param torque: Torque commanded this iteration [Nm]
+ * @param vel_estimate: Velocity estimate [turn/s]
+ */
+void Controller::gain_identification_update(float torque, float vel_estimate) {
+    GainIdentification_t& id = gain_identification_;
+
+    // Critically damped 2nd order low pass (two identical 1st order stages)
+    float prev_vel_f = id.vel_f[1];
+    float sign = (vel_estimate >= 0.0f) ? 1.0f : -1.0f;
+    id.vel_f[0] += id.filter_k * (vel_estimate - id.vel_f[0]);
+    id.vel_f[1] += id.filter_k * (id.vel_f[0] - id.vel_f[1]);
+    id.torque_f[0] += id.filter_k * (torque - id.torque_f[0]);
+    id.torque_f[1] += id.filter_k * (id.torque_f[0] - id.torque_f[1]);
+    id.sign_f[0] += id.filter_k * (sign - id.sign_f[0]);
+    id.sign_f[1] += id.filter_k * (id.sign_f[0] - id.sign_f[1]);
+
+    // Skip the first excitation period to let the filters settle
+    id.t += current_meas_period;
+    if (id.t > 1.0f / autotuning_.frequency) {
+        float phi[3] = {(id.vel_f[1] - prev_vel_f) * current_meas_hz, id.vel_f[1], id.sign_f[1]};
+        id.phi_phi[0] += phi[0] * phi[0];
+        id.phi_phi[1] += phi[0] * phi[1];
+        id.phi_phi[2] += phi[0] * phi[2];
+        id.phi_phi[3] += phi[1] * phi[1];
+        id.phi_phi[4] += phi[1] * phi[2];
+        id.phi_phi[5] += phi[2] * phi[2];
+        for (size_t i = 0; i < 3; ++i) {
+            id.phi_torque[i] += phi[i] * id.torque_f[1];
+        }
+    }
+
+    if (id.t < autotuning_.identification_duration + 1.0f / autotuning_.frequency) {
+        return;
+    }
+
+    // Done: solve the normal equations and stop the excitation
+    float x[3];
+    id.valid = solve_sym3x3(id.phi_phi, id.phi_torque, x) && (x[0] > 0.0f);
+    if (id.valid) {
+        id.inertia = x[0];
+        id.viscous_friction = std::max(x[1], 0.0f);
+        id.coulomb_friction = std::max(x[2], 0.0f);
+    }
+    config_.input_mode = id.prev_input_mode;
+    input_pos_updated();
+    id.active = false;
+}
+
+/**
+ * @brief Sets pos_gain, vel_gain, vel_integrator_gain and inertia from the
+ * identified inertia for a velocity loop bandwidth of autotuning_.target_bandwidth.
+ * 
+ * The velocity loop crosses over at vel_gain / J, the PI zero sits a factor
+ * of 4 below crossover and the position loop a factor of 4 below that.
+ */
+bool Controller::apply_identified_gains() {
+    const GainIdentification_t& id = gain_identification_;
+    if (id.active || !id.valid || autotuning_.target_bandwidth <= 0.0f) {
+        return false;
+    }
+
+    float bandwidth = std::min(2.0f * M_PI * autotuning_.target_bandwidth, 0.25f * M_PI * current_meas_hz); // [rad/s]
+    config_.inertia = id.inertia;
+    config_.vel_gain = id.inertia * bandwidth;
+    config_.vel_integrator_gain = 0.25f * bandwidth * config_.vel_gain;
+    config_.pos_gain = 0.25f * bandwidth;
+    return true;
+}
+
+// Velocity of friction calibration point i. The first half of the points
+// runs in positive direction from min_vel to max_vel, the second half the
+// same in negative direction.
+static float friction_calibration_point(const Controller::FrictionCalibration_t& fc, uint32_t i) {
+    float sign = (i < fc.num_points) ? 1.0f : -1.0f;
+    uint32_t k = i % fc.num_points;
+    return sign * fc.min_vel * powf(fc.max_vel / fc.min_vel, (float)k / (float)(fc.num_points - 1));
+}
+
+/**
+ * @brief Starts the friction calibration.
+ * 
+ * The axis is run in velocity control at each velocity of
+ * friction_calibration_ and the average torque is recorded once the
+ * velocity settled. Afterwards the friction model in config_ is fitted to
+ * the measurements.
+ * 
+ * The axis must be in closed loop control, free to rotate and should not
+ * carry a gravity load.
+ */
+bool Controller::start_friction_calibration() {
+    FrictionCalibration_t& fc = friction_calibration_;
+    if (axis_->current_state_ != Axis::AXIS_STATE_CLOSED_LOOP_CONTROL
+        || fc.num_points < 3 || fc.num_points > FRICTION_CALIB_POINTS
+        || !(fc.min_vel > 0.0f) || !(fc.max_vel > fc.min_vel)
+        || gain_identification_.active || frequency_response_.active) {
+        return false;
+    }
+
+    fc.prev_control_mode = config_.control_mode;
+    fc.prev_input_mode = config_.input_mode;
+    config_.control_mode = CONTROL_MODE_VELOCITY_CONTROL;
+    config_.input_mode = INPUT_MODE_PASSTHROUGH;
+    input_torque_ = 0.0f;
+
+    fc.index = 0;
+    fc.t = 0.0f;
+    fc.torque_sum = 0.0f;
+    fc.n_samples = 0;
+    fc.valid = false;
+    fc.active = true;
+    return true;
+}
+
+/**
+ * @brief Steps the friction calibration. Called from update() before the
+ * input mode is evaluated.
+ */
+void Controller::friction_calibration_update() {
+    FrictionCalibration_t& fc = friction_calibration_;
+
+    // Closed loop control was left (error or state change): abort and give
+    // back the modes, start_closed_loop_control() resyncs the setpoints.
+    if (axis_->current_state_ != Axis::AXIS_STATE_CLOSED_LOOP_CONTROL) {
+        input_vel_ = 0.0f;
+        config_.input_mode = fc.prev_input_mode;
+        config_.control_mode = fc.prev_control_mode;
+        fc.active = false;
+        return;
+    }
+
+    input_vel_ = friction_calibration_point(fc, fc.index);
+    fc.t += current_meas_period;
+    if (fc.t > fc.settle_time) {
+        fc.torque_sum += last_torque_; // torque needed to hold the velocity in the last iteration
+        fc.n_samples++;
+    }
+    if (fc.t < fc.settle_time + fc.measure_time) {
+        return;
+    }
+
+    fc.vel[fc.index] = input_vel_;
+    fc.torque[fc.index] = (fc.n_samples > 0) ? fc.torque_sum / (float)fc.n_samples : 0.0f;
+    fc.index++;
+    fc.t = 0.0f;
+    fc.torque_sum = 0.0f;
+    fc.n_samples = 0;
+
+    if (fc.index < 2 * fc.num_points) {
+        return;
+    }
+
+    // Done: bring the axis to a stop and fit the model
+    input_vel_ = 0.0f;
+    config_.input_mode = fc.prev_input_mode;
+    config_.control_mode = fc.prev_control_mode;
+    control_mode_updated();
+    fc.valid = fit_friction_model();
+    fc.active = false;
+}
+
+/**
+ * @brief Fits friction_coulomb, friction_stribeck and friction_viscous to
+ * the measurements of the friction calibration.
+ * 
+ * For a given Stribeck velocity the model is linear in the remaining
+ * parameters so they are found by least squares. The Stribeck velocity is
+ * chosen among the measured speeds as the one with the smallest residual.
+ */
+bool Controller::fit_friction_model() {
+    const FrictionCalibration_t& fc = friction_calibration_;
+    size_t n = 2 * fc.num_points;
+
+    bool found = false;
+    float best_residual = INFINITY;
+    float best_x[3] = {0.0f, 0.0f, 0.0f};
+    float best_vs = 0.0f;
+
+    for (size_t c = 0; c < fc.num_points; ++c) {
+        float vs = std::abs(fc.vel[c]);
+        float phi_phi[6] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+        float phi_torque[3] = {0.0f, 0.0f, 0.0f};
+        float torque_torque = 0.0f;
+        for (size_t i = 0; i < n; ++i) {
+            float sign = (fc.vel[i] >= 0.0f) ? 1.0f : -1.0f;
+            float phi[3] = {sign, sign * std::exp(-SQ(fc.vel[i] / vs)), fc.vel[i]};
+            phi_phi[0] += phi[0] * phi[0];
+            phi_phi[1] += phi[0] * phi[1];
+            phi_phi[2] += phi[0] * phi[2];
+            phi_phi[3] += phi[1] * phi[1];
+            phi_phi[4] += phi[1] * phi[2];
+            phi_phi[5] += phi[2] * phi[2];
+            for (size_t j = 0; j < 3; ++j) {
+                phi_torque[j] += phi[j] * fc.torque[i];
+            }
+            torque_torque += SQ(fc.torque[i]);
+        }
+
+        float x[3];
+        if (!solve_sym3x3(phi_phi, phi_torque, x)) {
+            continue;
+        }
+        float residual = torque_torque - (x[0] * phi_torque[0] + x[1] * phi_torque[1] + x[2] * phi_torque[2]);
+        if (residual < best_residual) {
+            best_residual = residual;
+            std::copy(std::begin(x), std::end(x), std::begin(best_x));
+            best_vs = vs;
+            found = true;
+        }
+    }
+
+    if (!found) {
+        return false;
+    }
+
+    config_.friction_coulomb = std::max(best_x[0], 0.0f);
+    config_.friction_stribeck = std::max(best_x[1], 0.0f);
+    config_.friction_viscous = std::max(best_x[2], 0.0f);
+    config_.friction_stribeck_velocity = best_vs;
+    return true;
+}
+
+/**
+ * @brief Friction torque predicted by the model in config_ at velocity vel.
+ */
+float Controller::friction_torque(float vel) {
+    float sign = (config_.friction_zero_vel_band > 0.0f)
+               ? std::clamp(vel / config_.friction_zero_vel_band, -1.0f, 1.0f)
+               : ((vel >= 0.0f) ? 1.0f : -1.0f);
+    float stribeck = (config_.friction_stribeck_velocity > 0.0f)
+                   ? config_.friction_stribeck * std::exp(-SQ(vel / config_.friction_stribeck_velocity))
+                   : 0.0f;
+    return sign * (config_.friction_coulomb + stribeck) + config_.friction_viscous * vel;
+}
+
+/**
+ * @brief Velocity and torque of friction calibration measurement index.
+ * Indices 0 ... num_points - 1 are the positive, the rest the negative direction.
+ */
+std::tuple<float, float> Controller::get_friction_calibration_point(uint32_t index) {
+    if (index >= 2 * FRICTION_CALIB_POINTS) {
+        return {0.0f, 0.0f};
+    }
+    return {friction_calibration_.vel[index], friction_calibration_.torque[index]};
+}
+
+// Excitation frequency of frequency response point i (logarithmically spaced).
+static float frequency_response_point(const Controller::FrequencyResponse_t& fr, uint32_t i) {
+    if (fr.sweep_points < 2) {
+        return fr.start_frequency;
+    }
+    return fr.start_frequency * powf(fr.sweep_stop_frequency / fr.start_frequency, (float)i / (float)(fr.sweep_points - 1));
+}
+
+/**
+ * @brief Starts a swept-sine frequency response measurement.
+ * 
+ * The amplitude of the excitation is taken from autotuning_ (torque_amplitude,
+ * vel_amplitude or pos_amplitude, depending on frequency_response_.loop) and
+ * should be the only non-zero amplitude. The axis must be in closed loop
+ * control, in a control mode that closes the measured loop.
+ * 
+ * Results are written to frequency_response_.{frequency, gain, phase}.
+ */
+bool Controller::start_frequency_response() {
+    FrequencyResponse_t& fr = frequency_response_;
+    float amplitude = (fr.loop == CONTROL_MODE_TORQUE_CONTROL) ? autotuning_.torque_amplitude
+                    : (fr.loop == CONTROL_MODE_VELOCITY_CONTROL) ? autotuning_.vel_amplitude
+                    : (fr.loop == CONTROL_MODE_POSITION_CONTROL) ? autotuning_.pos_amplitude
+                    : 0.0f;
+    if (axis_->current_state_ != Axis::AXIS_STATE_CLOSED_LOOP_CONTROL
+        || amplitude == 0.0f || fr.start_frequency <= 0.0f || fr.measure_cycles == 0
+        || config_.control_mode < fr.loop || gain_identification_.active) {
+        return false;
+    }
+
+    // The config stays as written, the sweep runs on clamped copies
+    fr.sweep_points = std::clamp<uint32_t>(fr.num_points, 1, FREQUENCY_RESPONSE_POINTS);
+    fr.sweep_stop_frequency = std::clamp(fr.stop_frequency, fr.start_frequency, 0.25f * current_meas_hz);
+    std::fill(std::begin(fr.gain), std::end(fr.gain), 0.0f);
+    std::fill(std::begin(fr.phase), std::end(fr.phase), 0.0f);
+
+    fr.index = 0;
+    fr.cycle = 0;
+    fr.prev_phase = 0.0f;
+    fr.setpoint_c = fr.setpoint_s = fr.response_c = fr.response_s = 0.0f;
+    fr.frequency[0] = frequency_response_point(fr, 0);
+    autotuning_.frequency = fr.frequency[0];
+    autotuning_phase_ = 0.0f;
+
+    fr.prev_input_mode = config_.input_mode;
+    config_.input_mode = INPUT_MODE_TUNING;
+    fr.active = true;
+    return true;
+}
+
+/**
+ * @brief Demodulates one sample of the frequency response measurement and
+ * advances to the next frequency when enough periods were integrated.
+ * Called from update().
+ */
+void Controller::frequency_response_update(float setpoint, float response) {
+    FrequencyResponse_t& fr = frequency_response_;
+
+    // A new excitation period starts whenever the tuning phase wraps
+    if (autotuning_phase_ < fr.prev_phase) {
+        fr.cycle++;
+    }
+    fr.prev_phase = autotuning_phase_;
+
+    if (fr.cycle < fr.settle_cycles) {
+        return;
+    }
+
+    if (fr.cycle < fr.settle_cycles + fr.measure_cycles) {
+        float c = our_arm_cos_f32(autotuning_phase_);
+        float s = our_arm_sin_f32(autotuning_phase_);
+        fr.setpoint_c += setpoint * c;
+        fr.setpoint_s += setpoint * s;
+        fr.response_c += response * c;
+        fr.response_s += response * s;
+        return;
+    }
+
+    // Point finished: H = response / setpoint at the excitation frequency
+    float setpoint_mag = std::sqrt(SQ(fr.setpoint_c) + SQ(fr.setpoint_s));
+    float response_mag = std::sqrt(SQ(fr.response_c) + SQ(fr.response_s));
+    fr.gain[fr.index] = (setpoint_mag > 0.0f) ? response_mag / setpoint_mag : 0.0f;
+    fr.phase[fr.index] = wrap_pm_pi(std::atan2(fr.response_s, fr.response_c) - std::atan2(fr.setpoint_s, fr.setpoint_c));
+
+    fr.index++;
+    fr.cycle = 0;
+    fr.setpoint_c = fr.setpoint_s = fr.response_c = fr.response_s = 0.0f;
+
+    if (fr.index < fr.sweep_points) {
+        fr.frequency[fr.index] = frequency_response_point(fr, fr.index);
+        autotuning_.frequency = fr.frequency[fr.index];
+    } else {
+        config_.input_mode = fr.prev_input_mode;
+        input_pos_updated();
+        fr.active = false;
+    }
+}
+
+/**
+ * @brief Frequency [Hz], gain and phase [rad] of frequency response point index.
+ */
+std::tuple<float, float, float> Controller::get_frequency_response_point(uint32_t index) {
+    const FrequencyResponse_t& fr = frequency_response_;
+    if (index >= FREQUENCY_RESPONSE_POINTS) {
+        return {0.0f, 0.0f, 0.0f};
+    }
+    return {fr.frequency[index], fr.gain[index], fr.phase[index]};
+}
+
 /**位置控制的核心逻辑，负责将目标位置（浮点数）转换为步进电机的“步数”。*/
 void Controller::set_input_pos_and_steps(float const pos) {
     input_pos_ = pos;
@@ -131,8 +560,67 @@ void Controller::set_input_pos_and_steps(float const pos) {
     }
 }
 
+void Controller::set_input_pos_and_steps(SplitPosition pos) {
+    input_pos_split_ = pos;
+    input_pos_ = input_pos_published_ = pos.to_float();
+    if (config_.circular_setpoints) {
+        set_input_pos_and_steps(input_pos_);
+    } else {
+        axis_->steps_ = (int64_t)pos.integer * config_.steps_per_circular_range
+                      + (int64_t)(pos.fraction * config_.steps_per_circular_range);
+    }
+}
+
+/**凸轮主轴位置和速度来自 CAN，两者在同一个临界区里更新，控制中断不会看到一半新一半旧的值。
+超时计数按 master_timeout 重新装载，计数归零后 update() 停止外推，保持最后的主轴位置。*/
+void Controller::set_cam_master(float pos, float vel) {
+    uint32_t ticks = static_cast<uint32_t>(std::clamp<float>(config_.cam.master_timeout, 0, UINT32_MAX / (current_meas_hz + 1)) * current_meas_hz);
+    CRITICAL_SECTION() {
+        cam_master_pos_ = pos;
+        cam_master_vel_ = vel;
+        cam_master_ticks_left_ = ticks;
+    }
+}
+
+/**
+ * pos_setpoint_ 和 input_pos_ 是 float，保留给通信接口和其它模块读写；线性位置
+ * 路径在内部使用整数 + 小数形式的 pos_setpoint_split_ 和 input_pos_split_。
+ * 如果 float 值在 update() 之外被改写（通信接口、回零等），就以 float 值为准重新同步。
+ * The float members stay the external interface. If one of them was written
+ * outside of update(), the split copy is resynchronized from it.
+ */
+void Controller::sync_split_positions() {
+    if (input_pos_ != input_pos_published_) {
+        input_pos_split_ = SplitPosition::from_float(input_pos_);
+        input_pos_published_ = input_pos_;
+    }
+    if (pos_setpoint_ != pos_setpoint_published_) {
+        pos_setpoint_split_ = SplitPosition::from_float(pos_setpoint_);
+        pos_setpoint_published_ = pos_setpoint_;
+    }
+}
+
+// Input modes that work on floats (circular setpoints, mirroring, tuning)
+// write pos_setpoint_, all others write pos_setpoint_split_.
+void Controller::publish_pos_setpoint() {
+    if (pos_setpoint_ != pos_setpoint_published_) {
+        pos_setpoint_split_ = SplitPosition::from_float(pos_setpoint_);
+    } else {
+        pos_setpoint_ = pos_setpoint_split_.to_float();
+    }
+    pos_setpoint_published_ = pos_setpoint_;
+}
+
 bool Controller::control_mode_updated() {
     if (config_.control_mode >= CONTROL_MODE_POSITION_CONTROL) {
+        std::optional<SplitPosition> split_estimate = pos_estimate_linear_split_src_.any();
+        if (!config_.circular_setpoints && split_estimate.has_value()) {
+            pos_setpoint_split_ = *split_estimate;
+            pos_setpoint_ = pos_setpoint_published_ = split_estimate->to_float();
+            set_input_pos_and_steps(*split_estimate);
+            return true;
+        }
+
         std::optional<float> estimate = (config_.circular_setpoints ?
                                 pos_estimate_circular_src_ :
                                 pos_estimate_linear_src_).any();
@@ -160,6 +648,83 @@ void Controller::update_filter_gains() {
     input_filter_kp_ = 0.25f * (input_filter_ki_ * input_filter_ki_); // Critically damped
 }
 
+/**
+ * 根据配置重新计算速度环滤波器组（陷波/低通）的系数，
+ * 只在配置改变时调用，不在控制循环中每次计算。*/
+void Controller::update_vel_filters() {
+    for (size_t i = 0; i < VEL_FILTER_COUNT; ++i) {
+        const VelFilter_t& cfg = config_.vel_filters[i];
+        vel_filters_[i].configure((Biquad::Type)cfg.type, cfg.frequency, cfg.q, current_meas_hz);
+    }
+}
+
+/**根据配置重新计算输入整形器（ZV/ZVD/EI）的脉冲幅值和延时，只在配置改变时调用。*/
+void Controller::update_input_shaper() {
+    input_shaper_.configure((InputShaper::Type)config_.input_shaper_type, config_.input_shaper_frequency,
+                            config_.input_shaper_damping, current_meas_period);
+    input_shaper_active_ = false; // restart from the current setpoint
+}
+
+/**增益调度表插值：在等间距断点之间线性插值，超出范围时取端点值，
+结果乘到 gains（pos_gain, vel_gain, vel_integrator_gain 的倍率）上。*/
+static void apply_gain_table(const Controller::GainTable_t& table, float x, float (&gains)[3]) {
+    if (!table.enabled || table.num_points < 2 || table.num_points > Controller::GAIN_TABLE_SIZE || !(table.max > table.min)) {
+        return;
+    }
+    float idx = (std::clamp(x, table.min, table.max) - table.min) / (table.max - table.min) * (float)(table.num_points - 1);
+    size_t i = std::min((size_t)idx, (size_t)table.num_points - 2);
+    float frac = idx - (float)i;
+    gains[0] *= table.pos_gain[i] + frac * (table.pos_gain[i + 1] - table.pos_gain[i]);
+    gains[1] *= table.vel_gain[i] + frac * (table.vel_gain[i + 1] - table.vel_gain[i]);
+    gains[2] *= table.vel_integrator_gain[i] + frac * (table.vel_integrator_gain[i + 1] - table.vel_integrator_gain[i]);
+}
+
+/**凸轮表和增益调度表的逐点读写，供 fibre 接口使用。索引越界时写入返回 false，读取返回 0。*/
+bool Controller::set_cam_point(uint32_t index, float pos) {
+    if (index >= CAM_TABLE_SIZE) {
+        return false;
+    }
+    config_.cam.table[index] = pos;
+    return true;
+}
+
+float Controller::get_cam_point(uint32_t index) {
+    return (index < CAM_TABLE_SIZE) ? config_.cam.table[index] : 0.0f;
+}
+
+static bool set_gain_table_point(Controller::GainTable_t& table, uint32_t index, float pos_gain, float vel_gain, float vel_integrator_gain) {
+    if (index >= Controller::GAIN_TABLE_SIZE) {
+        return false;
+    }
+    table.pos_gain[index] = pos_gain;
+    table.vel_gain[index] = vel_gain;
+    table.vel_integrator_gain[index] = vel_integrator_gain;
+    return true;
+}
+
+static std::tuple<float, float, float> get_gain_table_point(const Controller::GainTable_t& table, uint32_t index) {
+    if (index >= Controller::GAIN_TABLE_SIZE) {
+        return {0.0f, 0.0f, 0.0f};
+    }
+    return {table.pos_gain[index], table.vel_gain[index], table.vel_integrator_gain[index]};
+}
+
+bool Controller::set_pos_gain_table_point(uint32_t index, float pos_gain, float vel_gain, float vel_integrator_gain) {
+    return set_gain_table_point(config_.pos_gain_table, index, pos_gain, vel_gain, vel_integrator_gain);
+}
+
+std::tuple<float, float, float> Controller::get_pos_gain_table_point(uint32_t index) {
+    return get_gain_table_point(config_.pos_gain_table, index);
+}
+
+bool Controller::set_vel_gain_table_point(uint32_t index, float pos_gain, float vel_gain, float vel_integrator_gain) {
+    return set_gain_table_point(config_.vel_gain_table, index, pos_gain, vel_gain, vel_integrator_gain);
+}
+
+std::tuple<float, float, float> Controller::get_vel_gain_table_point(uint32_t index) {
+    return get_gain_table_point(config_.vel_gain_table, index);
+}
+
 /**速度限制函数，用于限制速度相关的扭矩指令大小，防止速度过冲或抖动。*/
 static float limitVel(const float vel_limit, const float vel_estimate, const float vel_gain, const float torque) {
     /*动态计算的扭矩上下限:当 vel_estimate 靠近 vel_limit 时，Tmax 减小，防
@@ -181,6 +746,7 @@ bool Controller::update() {
     /**从 Encoder 对象处实时获取电机位置估计值，pos_estimate_linear_src_，pos_estimate_circular_src_ 
      * 通过 connect_to 函数连接到 Encoder，可以从 Encoder 获取位置值）*/
     std::optional<float> pos_estimate_linear = pos_estimate_linear_src_.present();
+    std::optional<SplitPosition> pos_estimate_linear_split = pos_estimate_linear_split_src_.present();
     std::optional<float> pos_estimate_circular = pos_estimate_circular_src_.present();
     std::optional<float> pos_wrap = pos_wrap_src_.present();
 
@@ -205,10 +771,23 @@ bool Controller::update() {
             }
             input_pos_ = (float)(axis_->steps_ % config_.steps_per_circular_range) * (*pos_wrap / (float)(config_.steps_per_circular_range));
         } else {
-            input_pos_ = (float)(axis_->steps_) / (float)(config_.steps_per_circular_range);
+            int64_t range = config_.steps_per_circular_range;
+            int64_t turns = axis_->steps_ / range;
+            int64_t rem = axis_->steps_ % range;
+            if (rem < 0) {
+                rem += range;
+                turns -= 1;
+            }
+            input_pos_split_ = SplitPosition{(int32_t)turns, 0.0f} + (float)rem / (float)range;
+            input_pos_ = input_pos_published_ = input_pos_split_.to_float();
         }
     }
 
+    if (friction_calibration_.active) {
+        // non-blocking
+        friction_calibration_update();
+    }
+
     if (config_.anticogging.calib_anticogging) {
         if (!anticogging_pos_estimate.has_value() || !anticogging_vel_estimate.has_value()) {
             set_error(ERROR_INVALID_ESTIMATE);
@@ -228,6 +807,19 @@ bool Controller::update() {
         input_pos_ = fmodf_pos(input_pos_, *pos_wrap);
     }
 
+    sync_split_positions();
+
+    /**输入整形：输入模式在未整形的设定值上运行，整形后的设定值只用于后面的控制环。
+    Input shaping: the input modes integrate on the unshaped setpoints, only
+    the control loops below see the shaped ones.*/
+    bool shape_input = input_shaper_.enabled() && !config_.circular_setpoints
+                       && (config_.input_mode == INPUT_MODE_POS_FILTER || config_.input_mode == INPUT_MODE_TRAP_TRAJ);
+    if (shape_input && input_shaper_active_) {
+        pos_setpoint_split_ = input_shaper_origin_ + input_shaper_raw_.pos;
+        vel_setpoint_ = input_shaper_raw_.vel;
+        torque_setpoint_ = input_shaper_raw_.torque;
+    }
+
     // Update inputs, 输入模式处理
     switch (config_.input_mode) {
         case INPUT_MODE_INACTIVE: {
@@ -235,7 +827,11 @@ bool Controller::update() {
         } break;
         /*直接传入控制指令指定的目标位置值 input_pos_ 作为目标位置*/
         case INPUT_MODE_PASSTHROUGH: {
-            pos_setpoint_ = input_pos_;
+            if (config_.circular_setpoints) {
+                pos_setpoint_ = input_pos_;
+            } else {
+                pos_setpoint_split_ = input_pos_split_;
+            }
             vel_setpoint_ = input_vel_;
             torque_setpoint_ = input_torque_; 
         } break;
@@ -259,23 +855,65 @@ bool Controller::update() {
         /*二阶位置跟踪滤波器，平滑输入位置*/
         case INPUT_MODE_POS_FILTER: {
             // 2nd order pos tracking filter
-            float delta_pos = input_pos_ - pos_setpoint_; // Pos error
+            float delta_pos = input_pos_split_ - pos_setpoint_split_; // Pos error
             if (config_.circular_setpoints) {
                 if (!pos_wrap.has_value()) {
                     set_error(ERROR_INVALID_CIRCULAR_RANGE);
                     return false;
                 }
-                delta_pos = wrap_pm(delta_pos, *pos_wrap);
+                delta_pos = wrap_pm(input_pos_ - pos_setpoint_, *pos_wrap);
             }
             float delta_vel = input_vel_ - vel_setpoint_; // Vel error
             float accel = input_filter_kp_*delta_pos + input_filter_ki_*delta_vel; // Feedback
             torque_setpoint_ = accel * config_.inertia; // Accel
             vel_setpoint_ += current_meas_period * accel; // delta vel
-            pos_setpoint_ += current_meas_period * vel_setpoint_; // Delta pos
+            if (config_.circular_setpoints) {
+                pos_setpoint_ += current_meas_period * vel_setpoint_; // Delta pos
+            } else {
+                pos_setpoint_split_ += current_meas_period * vel_setpoint_; // Delta pos
+            }
         } break;
         /*镜像另一个轴的状态，即跟随另一个轴的状态*/
         case INPUT_MODE_MIRROR: {
-            if (config_.axis_to_mirror < AXIS_COUNT) {
+            if (config_.cam.enabled) {
+                /*电子凸轮：从轴位置按凸轮表跟随主轴位置，速度前馈取凸轮表斜率乘以主轴速度*/
+                // Electronic cam: the position follows the cam table indexed by the master position
+                float master_pos, master_vel;
+                if (config_.cam.master_source == CAM_MASTER_CAN) {
+                    // Extrapolate between CAN messages, hold the last position once they stop
+                    if (cam_master_ticks_left_ > 0) {
+                        cam_master_ticks_left_--;
+                        cam_master_pos_ += current_meas_period * cam_master_vel_;
+                        master_vel = cam_master_vel_;
+                    } else {
+                        master_vel = 0.0f;
+                    }
+                    master_pos = cam_master_pos_;
+                } else if (config_.axis_to_mirror < AXIS_COUNT) {
+                    std::optional<float> other_pos = axes[config_.axis_to_mirror].encoder_.pos_estimate_.present();
+                    std::optional<float> other_vel = axes[config_.axis_to_mirror].encoder_.vel_estimate_.present();
+                    if (!other_pos.has_value() || !other_vel.has_value()) {
+                        set_error(ERROR_INVALID_ESTIMATE);
+                        return false;
+                    }
+                    master_pos = *other_pos;
+                    master_vel = *other_vel;
+                } else {
+                    set_error(ERROR_INVALID_MIRROR_AXIS);
+                    return false;
+                }
+
+                if (config_.cam.num_points < 2 || config_.cam.num_points > CAM_TABLE_SIZE || !(config_.cam.master_period > 0.0f)) {
+                    set_error(ERROR_INVALID_INPUT_MODE);
+                    return false;
+                }
+                CamTable::Output cam = CamTable::eval(config_.cam.table, config_.cam.num_points,
+                                                      config_.cam.master_period, config_.cam.rise,
+                                                      master_pos - config_.cam.master_offset);
+                pos_setpoint_ = cam.pos;
+                vel_setpoint_ = cam.slope * master_vel;
+                torque_setpoint_ = 0.0f;
+            } else if (config_.axis_to_mirror < AXIS_COUNT) {
                 std::optional<float> other_pos = axes[config_.axis_to_mirror].encoder_.pos_estimate_.present();
                 std::optional<float> other_vel = axes[config_.axis_to_mirror].encoder_.vel_estimate_.present();
                 std::optional<float> other_torque = axes[config_.axis_to_mirror].controller_.torque_output_.present();
@@ -302,35 +940,41 @@ bool Controller::update() {
         /*梯形轨迹规划控制（加减速规划）*/
         case INPUT_MODE_TRAP_TRAJ: {
             if(input_pos_updated_){
-                move_to_pos(input_pos_);
+                move_to_pos(input_pos_split_);
                 input_pos_updated_ = false;
             }
             // Avoid updating uninitialized trajectory
-            if (trajectory_done_)
+            if (trajectory_done_ || trajectory_settle_ticks_)
                 break;
             
             if (axis_->trap_traj_.t_ > axis_->trap_traj_.Tf_) {
                 // Drop into position control mode when done to avoid problems on loop counter delta overflow
                 config_.control_mode = CONTROL_MODE_POSITION_CONTROL;
-                pos_setpoint_ = axis_->trap_traj_.Xf_;
+                pos_setpoint_split_ = trajectory_origin_ + axis_->trap_traj_.Xf_;
                 vel_setpoint_ = 0.0f;
                 torque_setpoint_ = 0.0f;
-                trajectory_done_ = true;
+                // With input shaping the shaped setpoint is still moving,
+                // the trajectory is only done once it has caught up
+                if (shape_input) {
+                    trajectory_settle_ticks_ = input_shaper_.settling_ticks();
+                } else {
+                    trajectory_done_ = true;
+                }
             } else {
                 TrapezoidalTrajectory::Step_t traj_step = axis_->trap_traj_.eval(axis_->trap_traj_.t_);
-                pos_setpoint_ = traj_step.Y;
+                pos_setpoint_split_ = trajectory_origin_ + traj_step.Y;
                 vel_setpoint_ = traj_step.Yd;
                 torque_setpoint_ = traj_step.Ydd * config_.inertia;
                 axis_->trap_traj_.t_ += current_meas_period;
             }
-            anticogging_pos_estimate = pos_setpoint_; // FF the position setpoint instead of the pos_estimate
+            anticogging_pos_estimate = pos_setpoint_split_.to_float(); // FF the position setpoint instead of the pos_estimate
         } break;
         /*调试/自动调谐，用于系统辨识*/
         case INPUT_MODE_TUNING: {
             autotuning_phase_ = wrap_pm_pi(autotuning_phase_ + (2.0f * M_PI * autotuning_.frequency * current_meas_period));
             float c = our_arm_cos_f32(autotuning_phase_);
             float s = our_arm_sin_f32(autotuning_phase_);
-            pos_setpoint_ = input_pos_ + autotuning_.pos_amplitude * s; // + pos_amp_c * c
+            pos_setpoint_split_ = input_pos_split_ + autotuning_.pos_amplitude * s; // + pos_amp_c * c
             vel_setpoint_ = input_vel_ + autotuning_.vel_amplitude * c;
             torque_setpoint_ = input_torque_ + autotuning_.torque_amplitude * -s;
         } break;
@@ -341,6 +985,39 @@ bool Controller::update() {
         
     }
 
+    publish_pos_setpoint();
+
+    if (shape_input) {
+        if (!input_shaper_active_) {
+            input_shaper_origin_ = pos_setpoint_split_;
+        }
+        input_shaper_raw_ = {pos_setpoint_split_ - input_shaper_origin_, vel_setpoint_, torque_setpoint_};
+        if (!input_shaper_active_) {
+            input_shaper_.reset(input_shaper_raw_);
+            input_shaper_active_ = true;
+        } else if (std::abs(input_shaper_raw_.pos) > 1.0f) {
+            // Keep the shaper positions small by moving the origin along in whole turns
+            float shift = std::trunc(input_shaper_raw_.pos);
+            input_shaper_origin_ += shift;
+            input_shaper_raw_.pos -= shift;
+            input_shaper_.shift_pos(shift);
+        }
+        InputShaper::Sample shaped = input_shaper_.update(input_shaper_raw_);
+        pos_setpoint_split_ = input_shaper_origin_ + shaped.pos;
+        pos_setpoint_ = pos_setpoint_published_ = pos_setpoint_split_.to_float();
+        vel_setpoint_ = shaped.vel;
+        torque_setpoint_ = shaped.torque;
+    } else {
+        input_shaper_active_ = false;
+        if (trajectory_settle_ticks_) {
+            trajectory_settle_ticks_ = 1; // shaping was turned off, nothing left to wait for
+        }
+    }
+
+    if (trajectory_settle_ticks_ && !--trajectory_settle_ticks_) {
+        trajectory_done_ = true;
+    }
+
     /*输入模式和控制模式的区别：输入模式决定 “目标怎么来”（目标值如何生成和处理。），
     控制模式决定 “怎么控制到目标”（决定控制器实际执行哪种闭环环路）。*/
 
@@ -356,6 +1033,24 @@ bool Controller::update() {
     float gain_scheduling_multiplier = 1.0f;
     float vel_des = vel_setpoint_;
 
+    // Gain scheduling tables: multipliers for {pos_gain, vel_gain, vel_integrator_gain}
+    float table_gains[3] = {1.0f, 1.0f, 1.0f};
+    if (config_.pos_gain_table.enabled) {
+        std::optional<float> table_pos = config_.circular_setpoints ? pos_estimate_circular : pos_estimate_linear;
+        if (!table_pos.has_value()) {
+            set_error(ERROR_INVALID_ESTIMATE);
+            return false;
+        }
+        apply_gain_table(config_.pos_gain_table, *table_pos, table_gains);
+    }
+    if (config_.vel_gain_table.enabled) {
+        if (!vel_estimate.has_value()) {
+            set_error(ERROR_INVALID_ESTIMATE);
+            return false;
+        }
+        apply_gain_table(config_.vel_gain_table, std::abs(*vel_estimate), table_gains);
+    }
+
     /**
      * gain_scheduling_multiplier 作用是根据位置误差动态调整控制器的各个增益 
      * (vel_gain, vel_integrator_gain)，实现 “增益调度” (gain scheduling)。
@@ -394,16 +1089,19 @@ bool Controller::update() {
             而不会因为数值跳变导致控制异常。*/
             pos_err = wrap_pm(pos_err, *pos_wrap);
         } else {
-            if (!pos_estimate_linear.has_value()) {
+            if (pos_estimate_linear_split.has_value()) {
+                pos_err = pos_setpoint_split_ - *pos_estimate_linear_split;
+            } else if (pos_estimate_linear.has_value()) {
+                pos_err = pos_setpoint_ - *pos_estimate_linear;
+            } else {
                 set_error(ERROR_INVALID_ESTIMATE);
                 return false;
             }
-            pos_err = pos_setpoint_ - *pos_estimate_linear;
         }
 
         /**这里是典型的比例控制，vel_des 即将位置误差乘以比例增益 
          * (pos_gain)，并加到期望速度 vel_des 上。*/
-        vel_des += config_.pos_gain * pos_err;
+        vel_des += (config_.pos_gain * table_gains[0]) * pos_err;
         // V-shaped gain shedule based on position error
         float abs_pos_err = std::abs(pos_err);
         /*当 enable_gain_scheduling 使能，并且位置误差 abs_pos_err 在 
@@ -434,8 +1132,8 @@ bool Controller::update() {
 
     // TODO: Change to controller working in torque units
     // Torque per amp gain scheduling (ACIM)
-    float vel_gain = config_.vel_gain;
-    float vel_integrator_gain = config_.vel_integrator_gain; /*获取速度积分增益*/
+    float vel_gain = config_.vel_gain * table_gains[1];
+    float vel_integrator_gain = config_.vel_integrator_gain * table_gains[2]; /*获取速度积分增益*/
     if (axis_->motor_.config_.motor_type == Motor::MOTOR_TYPE_ACIM) {
         float effective_flux = axis_->acim_estimator_.rotor_flux_;
         float minflux = axis_->motor_.config_.acim_gain_min_flux;
@@ -465,6 +1163,13 @@ bool Controller::update() {
         torque += config_.anticogging.cogging_map[std::clamp(mod((int)anticogging_pos, 3600), 0, 3600)];
     }
 
+    /**摩擦力前馈：按期望速度计算库仑、粘滞和 Stribeck 摩擦力矩并前馈补偿，
+    使用期望速度而不是速度估计，以免在零速附近因噪声而来回切换。*/
+    // Friction feed-forward based on the desired velocity
+    if (config_.enable_friction_compensation && config_.control_mode >= CONTROL_MODE_VELOCITY_CONTROL) {
+        torque += friction_torque(vel_des);
+    }
+
     /**转速闭环控制*/
     float v_err = 0.0f;
     if (config_.control_mode >= CONTROL_MODE_VELOCITY_CONTROL) {
@@ -475,6 +1180,11 @@ bool Controller::update() {
         }
 
         v_err = vel_des - *vel_estimate;
+        if (!config_.vel_filters_on_torque) {
+            for (auto& vel_filter: vel_filters_) {
+                v_err = vel_filter.update(v_err);
+            }
+        }
         /**torque 即将位置误差乘以比例增益 (vel_gain)，
          * 并加到期望力矩 torque 上。这里是典型的比例控制*/
         torque += (vel_gain * gain_scheduling_multiplier) * v_err;
@@ -484,6 +1194,26 @@ bool Controller::update() {
         /*vel_integrator_torque_ 的更新逻辑在下面部分*/
     }
 
+    /**负载扰动观测器：根据模型 J*dv/dt = T - T_load，由速度估计和上一次输出的扭矩估算外部负载扭矩并前馈补偿。
+    避免对速度求导：z = T_load_hat + L*J*v，dz/dt = L*(T - T_load_hat)。*/
+    // Load torque disturbance observer
+    float dob_bandwidth = std::min(config_.disturbance_observer_bandwidth, 0.25f * current_meas_hz);
+    if (config_.enable_disturbance_observer && config_.control_mode >= CONTROL_MODE_VELOCITY_CONTROL && config_.inertia > 0.0f) {
+        disturbance_observer_state_ += (dob_bandwidth * current_meas_period) * (last_torque_ - load_torque_estimate_);
+        load_torque_estimate_ = disturbance_observer_state_ - dob_bandwidth * config_.inertia * *vel_estimate;
+        torque += load_torque_estimate_;
+    } else {
+        // Keep the observer primed so that enabling it does not cause a jump
+        load_torque_estimate_ = 0.0f;
+        disturbance_observer_state_ = vel_estimate.has_value() ? dob_bandwidth * config_.inertia * *vel_estimate : 0.0f;
+    }
+
+    if (config_.vel_filters_on_torque) {
+        for (auto& vel_filter: vel_filters_) {
+            torque = vel_filter.update(torque);
+        }
+    }
+
     /**电流闭环控制（即力矩控制环）*/
     // Velocity limiting in current mode
     if (config_.control_mode < CONTROL_MODE_VELOCITY_CONTROL && config_.enable_torque_mode_vel_limit) {
@@ -551,7 +1281,51 @@ bool Controller::update() {
         return false;
     }
 
+    if (gain_identification_.active && axis_->current_state_ != Axis::AXIS_STATE_CLOSED_LOOP_CONTROL) {
+        // Closed loop control was left: abort and give back the input mode
+        config_.input_mode = gain_identification_.prev_input_mode;
+        gain_identification_.active = false;
+    }
+
+    if (gain_identification_.active) {
+        if (!vel_estimate.has_value()) {
+            set_error(ERROR_INVALID_ESTIMATE);
+            return false;
+        }
+        gain_identification_update(torque, *vel_estimate);
+    }
+
+    if (frequency_response_.active && axis_->current_state_ != Axis::AXIS_STATE_CLOSED_LOOP_CONTROL) {
+        // Closed loop control was left: abort and give back the input mode
+        config_.input_mode = frequency_response_.prev_input_mode;
+        frequency_response_.active = false;
+    }
+
+    if (frequency_response_.active) {
+        std::optional<float> fr_setpoint;
+        std::optional<float> fr_response;
+        if (frequency_response_.loop == CONTROL_MODE_POSITION_CONTROL) {
+            fr_setpoint = pos_setpoint_;
+            fr_response = config_.circular_setpoints ? pos_estimate_circular : pos_estimate_linear;
+        } else if (frequency_response_.loop == CONTROL_MODE_VELOCITY_CONTROL) {
+            fr_setpoint = vel_setpoint_;
+            fr_response = vel_estimate;
+        } else {
+            std::optional<float2D> Idq_setpoint = axis_->motor_.current_control_.Idq_setpoint_;
+            if (Idq_setpoint.has_value()) {
+                fr_setpoint = Idq_setpoint->second;
+            }
+            fr_response = axis_->motor_.current_control_.Iq_measured_;
+        }
+        if (!fr_setpoint.has_value() || !fr_response.has_value()) {
+            set_error(ERROR_INVALID_ESTIMATE);
+            return false;
+        }
+        frequency_response_update(*fr_setpoint, *fr_response);
+    }
+
     /*经过上面的三个控制环计算 Controller 对象向外部输出合成的最终扭矩（电流）*/
+    last_torque_ = torque;
     torque_output_ = torque;
 
     // TODO: this is inconsistent with the other errors which are sticky.
@@ -1,6 +1,14 @@
 #ifndef __CONTROLLER_HPP
 #define __CONTROLLER_HPP
 
+#include <algorithm>
+#include <iterator>
+
+#include "biquad.hpp"
+#include "input_shaper.hpp"
+#include "split_position.hpp"
+#include "cam_table.hpp"
+
 class Controller : public ODriveIntf::ControllerIntf {
 public:
     struct Anticogging_t {
@@ -19,6 +27,137 @@ public:
         float pos_amplitude = 0.0f;
         float vel_amplitude = 0.0f;
         float torque_amplitude = 0.0f;
+        float target_bandwidth = 10.0f;         // [Hz] velocity loop bandwidth that gain identification tunes for
+        float identification_duration = 5.0f;   // [s] excitation time used for gain identification
+    };
+
+    // Plant identification T = J*a + b*v + Tc*sign(v) from the tuning excitation.
+    // All signals go through the same 2nd order low pass so that the
+    // acceleration can be taken as the derivative of the filtered velocity.
+    struct GainIdentification_t {
+        bool active = false;
+        bool valid = false;
+        InputMode prev_input_mode = INPUT_MODE_PASSTHROUGH;
+        float t = 0.0f;                  // [s]
+        float filter_k = 0.0f;
+        float vel_f[2] = {0.0f, 0.0f};    // filtered velocity [turn/s]
+        float torque_f[2] = {0.0f, 0.0f}; // filtered torque [Nm]
+        float sign_f[2] = {0.0f, 0.0f};   // filtered velocity sign
+        float phi_phi[6];                 // upper triangle of sum(phi * phi^T), phi = [a, v, sign(v)]
+        float phi_torque[3];              // sum(phi * T)
+        float inertia = 0.0f;             // [Nm/(turn/s^2)]
+        float viscous_friction = 0.0f;    // [Nm/(turn/s)]
+        float coulomb_friction = 0.0f;    // [Nm]
+    };
+
+    static constexpr size_t FREQUENCY_RESPONSE_POINTS = 32;
+
+    // Swept-sine measurement of the closed loop response of one control loop.
+    // The INPUT_MODE_TUNING excitation is stepped through logarithmically
+    // spaced frequencies and setpoint and measurement are demodulated at the
+    // excitation frequency over an integer number of periods.
+    struct FrequencyResponse_t {
+        float start_frequency = 1.0f;   // [Hz]
+        float stop_frequency = 100.0f;  // [Hz]
+        uint32_t num_points = FREQUENCY_RESPONSE_POINTS;
+        uint32_t settle_cycles = 3;     // excitation periods discarded after each frequency step
+        uint32_t measure_cycles = 5;    // excitation periods integrated per point
+        ControlMode loop = CONTROL_MODE_VELOCITY_CONTROL; // TORQUE: current loop, VELOCITY: velocity loop, POSITION: position loop
+
+        bool active = false;
+        InputMode prev_input_mode = INPUT_MODE_PASSTHROUGH;
+        uint32_t sweep_points = 0;      // num_points of the running sweep, clamped to FREQUENCY_RESPONSE_POINTS
+        float sweep_stop_frequency = 0.0f; // [Hz] stop_frequency of the running sweep, clamped to the sample rate
+        uint32_t index = 0;             // point currently being measured
+        uint32_t cycle = 0;
+        float prev_phase = 0.0f;
+        float setpoint_c = 0.0f, setpoint_s = 0.0f;
+        float response_c = 0.0f, response_s = 0.0f;
+
+        // Results
+        float frequency[FREQUENCY_RESPONSE_POINTS]; // [Hz]
+        float gain[FREQUENCY_RESPONSE_POINTS];      // response amplitude / setpoint amplitude
+        float phase[FREQUENCY_RESPONSE_POINTS];     // [rad] response phase relative to setpoint
+    };
+
+    static constexpr size_t FRICTION_CALIB_POINTS = 8; // per direction
+
+    // Measures the steady state torque at a range of constant velocities in
+    // both directions and fits the friction model of Config_t to it.
+    struct FrictionCalibration_t {
+        float min_vel = 0.05f;      // [turn/s] slowest measured velocity
+        float max_vel = 2.0f;       // [turn/s] fastest measured velocity
+        uint32_t num_points = FRICTION_CALIB_POINTS; // velocities per direction (logarithmically spaced)
+        float settle_time = 0.5f;   // [s] wait after each velocity step
+        float measure_time = 0.5f;  // [s] torque averaging time
+
+        bool active = false;
+        bool valid = false;         // true if the last calibration produced a model
+        ControlMode prev_control_mode = CONTROL_MODE_VELOCITY_CONTROL;
+        InputMode prev_input_mode = INPUT_MODE_PASSTHROUGH;
+        uint32_t index = 0;
+        float t = 0.0f;             // [s]
+        float torque_sum = 0.0f;
+        uint32_t n_samples = 0;
+
+        // Measurements
+        float vel[2 * FRICTION_CALIB_POINTS];    // [turn/s]
+        float torque[2 * FRICTION_CALIB_POINTS]; // [Nm]
+    };
+
+    static constexpr size_t GAIN_TABLE_SIZE = 16;
+
+    // Gain multipliers at num_points equally spaced breakpoints from min to
+    // max, linearly interpolated and clamped at the ends. All breakpoints
+    // default to 1, so raising num_points does not pull in zero gains.
+    struct GainTable_t {
+        GainTable_t() {
+            std::fill(std::begin(pos_gain), std::end(pos_gain), 1.0f);
+            std::fill(std::begin(vel_gain), std::end(vel_gain), 1.0f);
+            std::fill(std::begin(vel_integrator_gain), std::end(vel_integrator_gain), 1.0f);
+        }
+        bool enabled = false;
+        float min = 0.0f;
+        float max = 1.0f;
+        uint32_t num_points = 2;
+        float pos_gain[GAIN_TABLE_SIZE];
+        float vel_gain[GAIN_TABLE_SIZE];
+        float vel_integrator_gain[GAIN_TABLE_SIZE];
+    };
+
+    static constexpr size_t CAM_TABLE_SIZE = 64;
+
+    enum CamMasterSource {
+        CAM_MASTER_AXIS = 0,  // encoder of axis_to_mirror
+        CAM_MASTER_CAN = 1,   // CAN Simple "Set Cam Master" message
+    };
+
+    // Electronic cam, replaces mirror_ratio in INPUT_MODE_MIRROR when enabled.
+    // See CamTable for how the table is interpreted.
+    struct Cam_t {
+        bool enabled = false;
+        uint8_t master_source = CAM_MASTER_AXIS;  // see CamMasterSource
+        float master_offset = 0.0f;   // [turns] master position of table point 0
+        float master_period = 1.0f;   // [turns] master travel covered by the table
+        float rise = 0.0f;            // [turns] slave travel per master period
+        uint32_t num_points = 2;
+        float table[CAM_TABLE_SIZE] = {0.0f, 0.0f};  // [turns] slave position at evenly spaced master positions
+        float master_timeout = 0.1f;  // [s] CAM_MASTER_CAN: hold the master position when no update arrived for this long
+    };
+
+    static constexpr size_t VEL_FILTER_COUNT = 4;
+
+    // One second order section of the velocity loop filter bank
+    struct VelFilter_t {
+        uint8_t type = Biquad::TYPE_NONE; // see Biquad::Type
+        float frequency = 100.0f;         // [Hz] corner or notch frequency
+        float q = 0.707f;                 // quality factor (notch: frequency / bandwidth)
+
+        // custom setters
+        Controller* parent;
+        void set_type(uint8_t value) { type = value; parent->update_vel_filters(); }
+        void set_frequency(float value) { frequency = value; parent->update_vel_filters(); }
+        void set_q(float value) { q = value; parent->update_vel_filters(); }
     };
 
     struct Config_t {
@@ -39,6 +178,8 @@ public:
         float inertia = 0.0f;                    // [Nm/(turn/s^2)]
         float input_filter_bandwidth = 2.0f;     // [1/s] 例如，如果你要在 20Hz 频率下发送位置命令，请将滤波器带宽设置为 20.0 [1/s]
         float homing_speed = 0.25f;              // [turn/s]
+        float homing_fast_speed = 0.0f;          // [turn/s] first approach before backing off, disabled unless faster than homing_speed
+        float homing_backoff_distance = 0.25f;   // [turn] back-off between the fast and the slow approach
         Anticogging_t anticogging;
         float gain_scheduling_width = 10.0f;
         bool enable_gain_scheduling = false;
@@ -48,17 +189,36 @@ public:
         uint8_t axis_to_mirror = -1;
         float mirror_ratio = 1.0f;
         float torque_mirror_ratio = 0.0f;
+        Cam_t cam;
         uint8_t load_encoder_axis = -1;  // default depends on Axis number and is set in load_configuration(). Set to -1 to select sensorless estimator.
         float mechanical_power_bandwidth = 20.0f; // [rad/s] filter cutoff for mechanical power for spinout detction
         float electrical_power_bandwidth = 20.0f; // [rad/s] filter cutoff for electrical power for spinout detection
         float spinout_electrical_power_threshold = 10.0f; // [W] electrical power threshold for spinout detection
         float spinout_mechanical_power_threshold = -10.0f; // [W] mechanical power threshold for spinout detection
+        VelFilter_t vel_filters[VEL_FILTER_COUNT];  // notch/low-pass chain in the velocity loop
+        bool vel_filters_on_torque = false;         // false: filter the velocity error, true: filter the torque command
+        GainTable_t pos_gain_table;                 // gain multipliers indexed by position [turns]
+        GainTable_t vel_gain_table;                 // gain multipliers indexed by absolute velocity [turn/s]
+        bool enable_friction_compensation = false;  // feed forward T = sign(v)*(Tc + Ts*exp(-(v/vs)^2)) + b*v
+        float friction_coulomb = 0.0f;              // [Nm] Tc
+        float friction_stribeck = 0.0f;             // [Nm] Ts, breakaway friction in excess of Tc
+        float friction_stribeck_velocity = 0.1f;    // [turn/s] vs
+        float friction_viscous = 0.0f;              // [Nm/(turn/s)] b
+        float friction_zero_vel_band = 0.01f;       // [turn/s] sign(v) is ramped linearly within this band
+        bool enable_disturbance_observer = false;   // estimate the load torque and feed it forward (requires inertia)
+        float disturbance_observer_bandwidth = 200.0f; // [rad/s]
+        uint8_t input_shaper_type = InputShaper::TYPE_NONE; // see InputShaper::Type. Applies to INPUT_MODE_POS_FILTER and INPUT_MODE_TRAP_TRAJ
+        float input_shaper_frequency = 10.0f;       // [Hz] frequency of the mode to suppress
+        float input_shaper_damping = 0.0f;          // damping ratio of the mode to suppress
 
         // custom setters
         Controller* parent;
         void set_input_filter_bandwidth(float value) { input_filter_bandwidth = value; parent->update_filter_gains(); }
         void set_steps_per_circular_range(uint32_t value) { steps_per_circular_range = value > 0 ? value : steps_per_circular_range; }
         void set_control_mode(ControlMode value) { control_mode = value; parent->control_mode_updated(); }
+        void set_input_shaper_type(uint8_t value) { input_shaper_type = value; parent->update_input_shaper(); }
+        void set_input_shaper_frequency(float value) { input_shaper_frequency = value; parent->update_input_shaper(); }
+        void set_input_shaper_damping(float value) { input_shaper_damping = value; parent->update_input_shaper(); }
     };
 
     
@@ -72,11 +232,24 @@ public:
     }
     bool control_mode_updated();
     void set_input_pos_and_steps(float pos);
+    void set_input_pos_and_steps(SplitPosition pos);
+    void set_cam_master(float pos, float vel);
+    void sync_split_positions();
+    void publish_pos_setpoint();
+
+    // Setpoints before input shaping, which the input modes and trajectories
+    // are planned on
+    SplitPosition unshaped_pos_setpoint() const {
+        return input_shaper_active_ ? input_shaper_origin_ + input_shaper_raw_.pos : pos_setpoint_split_;
+    }
+    float unshaped_vel_setpoint() const {
+        return input_shaper_active_ ? input_shaper_raw_.vel : vel_setpoint_;
+    }
 
     bool select_encoder(size_t encoder_num);
 
     // Trajectory-Planned control
-    void move_to_pos(float goal_point);
+    void move_to_pos(SplitPosition goal_point);
     void move_incremental(float displacement, bool from_goal_point);
     
     // TODO: make this more similar to other calibration loops
@@ -84,11 +257,38 @@ public:
     float remove_anticogging_bias();
     bool anticogging_calibration(float pos_estimate, float vel_estimate);
     
+    // Gain identification using the INPUT_MODE_TUNING excitation
+    bool start_gain_identification();
+    void gain_identification_update(float torque, float vel_estimate);
+    bool apply_identified_gains();
+
+    // Friction identification and compensation
+    bool start_friction_calibration();
+    void friction_calibration_update();
+    bool fit_friction_model();
+    float friction_torque(float vel);
+    std::tuple<float, float> get_friction_calibration_point(uint32_t index);
+
+    // Swept-sine frequency response measurement
+    bool start_frequency_response();
+    void frequency_response_update(float setpoint, float response);
+    std::tuple<float, float, float> get_frequency_response_point(uint32_t index);
+
     float get_anticogging_value(uint32_t index) {
         return (index < 3600) ? config_.anticogging.cogging_map[index] : 0.0f;
     }
 
+    // Table access for the fibre interface
+    bool set_cam_point(uint32_t index, float pos);
+    float get_cam_point(uint32_t index);
+    bool set_pos_gain_table_point(uint32_t index, float pos_gain, float vel_gain, float vel_integrator_gain);
+    std::tuple<float, float, float> get_pos_gain_table_point(uint32_t index);
+    bool set_vel_gain_table_point(uint32_t index, float pos_gain, float vel_gain, float vel_integrator_gain);
+    std::tuple<float, float, float> get_vel_gain_table_point(uint32_t index);
+
     void update_filter_gains();
+    void update_vel_filters();
+    void update_input_shaper();
     bool update();
 
     Config_t config_;
@@ -99,28 +299,51 @@ public:
 
     // Inputs
     InputPort<float> pos_estimate_linear_src_;
+    InputPort<SplitPosition> pos_estimate_linear_split_src_;
     InputPort<float> pos_estimate_circular_src_;
     InputPort<float> vel_estimate_src_;
     InputPort<float> pos_wrap_src_; 
 
     float pos_setpoint_ = 0.0f; // [turns]
+    SplitPosition pos_setpoint_split_;      // [turns] linear setpoint, pos_setpoint_ is a float copy
+    float pos_setpoint_published_ = 0.0f;   // [turns] last value written to pos_setpoint_ by update()
     float vel_setpoint_ = 0.0f; // [turn/s]
     // float vel_setpoint = 800.0f; <sensorless example>
     float vel_integrator_torque_ = 0.0f;    // [Nm]
     float torque_setpoint_ = 0.0f;  // [Nm]
 
     float input_pos_ = 0.0f;     // [turns]
+    SplitPosition input_pos_split_;         // [turns]
+    float input_pos_published_ = 0.0f;     // [turns] last value of input_pos_ seen by the split path
+    SplitPosition trajectory_origin_;       // [turns] trap_traj_ positions are relative to this
     float input_vel_ = 0.0f;     // [turn/s]
     float input_torque_ = 0.0f;  // [Nm]
     float input_filter_kp_ = 0.0f;
     float input_filter_ki_ = 0.0f;
+    Biquad vel_filters_[VEL_FILTER_COUNT];
+    InputShaper input_shaper_;
+    InputShaper::Sample input_shaper_raw_;  // unshaped setpoints of the input mode, pos relative to input_shaper_origin_
+    SplitPosition input_shaper_origin_;     // [turns]
+    bool input_shaper_active_ = false;
+
+    float disturbance_observer_state_ = 0.0f; // [Nm] observer integrator
+    float load_torque_estimate_ = 0.0f;       // [Nm] external load torque (positive opposes positive torque)
+    float last_torque_ = 0.0f;                // [Nm] torque output of the previous iteration
 
     Autotuning_t autotuning_;
     float autotuning_phase_ = 0.0f;
+    GainIdentification_t gain_identification_;
+    FrequencyResponse_t frequency_response_;
+    FrictionCalibration_t friction_calibration_;
     
+    float cam_master_pos_ = 0.0f;  // [turns] master position received over CAN, extrapolated with cam_master_vel_
+    float cam_master_vel_ = 0.0f;  // [turn/s]
+    uint32_t cam_master_ticks_left_ = 0;  // remaining control ticks until the CAN master position is stale
+
     bool input_pos_updated_ = false;
     
     bool trajectory_done_ = true;
+    uint32_t trajectory_settle_ticks_ = 0; // remaining ticks until the shaped setpoint reaches the end of the trajectory
 
     bool anticogging_valid_ = false;
     float mechanical_power_ = 0.0f; // [W]
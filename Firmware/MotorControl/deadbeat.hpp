@@ -0,0 +1,116 @@
+#ifndef __DEADBEAT_HPP
+#define __DEADBEAT_HPP
+
+#include <utility>
+
+/**
+ * @brief Deadbeat predictive current regulator in the rotor (d/q) frame.
+ *
+ * Motor model:
+ *   Ld * dId/dt = Vd - R * Id + w * Lq * Iq
+ *   Lq * dIq/dt = Vq - R * Iq - w * Ld * Id - w * psi
+ *
+ * The voltage computed from the sample at k is applied during the period
+ * after the next one (k + 1 ... k + 2), while the voltage from the previous
+ * call is being output now. So the current at k + 1 is first predicted from
+ * the measurement and the previously applied voltage, and the new voltage is
+ * chosen such that the current reaches the setpoint at k + 2.
+ * The model is discretized exactly enough for the cross-coupling at high
+ * electrical speed, see discretize().
+ * With gain < 1 only that fraction of the remaining error is corrected per
+ * period, which trades response time for robustness to inductance errors.
+ */
+struct DeadbeatCurrentRegulator {
+    using float2 = std::pair<float, float>;
+
+    void reset() {
+        V_applied_ = {0.0f, 0.0f};
+    }
+
+    // Current at the end of a period of length Ts with the voltage V applied
+    float2 predict(float2 Idq, float2 Vdq, float w) const {
+        Model m = discretize(w);
+        auto [Id, Iq] = Idq;
+        float dId = m.a11 * Id + m.a12 * Iq + Vdq.first / Ld_;
+        float dIq = m.a21 * Id + m.a22 * Iq + (Vdq.second - w * flux_linkage_) / Lq_;
+        return {
+            Id + m.s11 * dId + m.s12 * dIq,
+            Iq + m.s21 * dId + m.s22 * dIq
+        };
+    }
+
+    // Voltage for the period after the one that is being output now
+    float2 get_voltage(float2 Idq_measured, float2 Idq_setpoint, float w) const {
+        auto [Id_pred, Iq_pred] = predict(Idq_measured, V_applied_, w);
+        float dId = gain_ * (Idq_setpoint.first - Id_pred);
+        float dIq = gain_ * (Idq_setpoint.second - Iq_pred);
+
+        // Solve dI = S * (A * I_pred + B * (V + e)) for V
+        Model m = discretize(w);
+        float det = m.s11 * m.s22 - m.s12 * m.s21;
+        float rate_d = (m.s22 * dId - m.s12 * dIq) / det;
+        float rate_q = (m.s11 * dIq - m.s21 * dId) / det;
+        return {
+            Ld_ * (rate_d - m.a11 * Id_pred - m.a12 * Iq_pred),
+            Lq_ * (rate_q - m.a21 * Id_pred - m.a22 * Iq_pred) + w * flux_linkage_
+        };
+    }
+
+    // Must be called with the voltage that is actually applied (after
+    // saturation) for each call to get_voltage()
+    void set_applied_voltage(float2 Vdq) {
+        V_applied_ = Vdq;
+    }
+
+    bool is_valid() const {
+        return Ld_ > 0.0f && Lq_ > 0.0f && Ts_ > 0.0f;
+    }
+
+    // Config
+    float R_ = 0.0f;            // [Ohm]
+    float Ld_ = 0.0f;           // [H]
+    float Lq_ = 0.0f;           // [H]
+    float flux_linkage_ = 0.0f; // [Wb]
+    float gain_ = 1.0f;         // fraction of the error corrected per period
+    float Ts_ = 0.0f;           // [s] current controller period
+
+    // State
+    float2 V_applied_ = {0.0f, 0.0f}; // [V] voltage of the period that is being output now
+
+   private:
+    // dI/dt = A * I + B * (V + e), discretized as I(k+1) = I + S * (A * I + B * (V + e))
+    // with S = Ts * (I + Ts * A / 2 + Ts^2 * A^2 / 6 + Ts^3 * A^3 / 24), a
+    // truncated series of the matrix exponential. This stays accurate up to
+    // w * Ts of about 0.5, where forward Euler would already be unstable.
+    struct Model {
+        float a11, a12, a21, a22;
+        float s11, s12, s21, s22;
+    };
+
+    Model discretize(float w) const {
+        Model m;
+        m.a11 = -R_ / Ld_;
+        m.a12 = w * Lq_ / Ld_;
+        m.a21 = -w * Ld_ / Lq_;
+        m.a22 = -R_ / Lq_;
+
+        float h1 = Ts_ * 0.5f;
+        float h2 = Ts_ * Ts_ * (1.0f / 6.0f);
+        float h3 = Ts_ * Ts_ * Ts_ * (1.0f / 24.0f);
+        float aa11 = m.a11 * m.a11 + m.a12 * m.a21;
+        float aa12 = m.a11 * m.a12 + m.a12 * m.a22;
+        float aa21 = m.a21 * m.a11 + m.a22 * m.a21;
+        float aa22 = m.a21 * m.a12 + m.a22 * m.a22;
+        float aaa11 = aa11 * m.a11 + aa12 * m.a21;
+        float aaa12 = aa11 * m.a12 + aa12 * m.a22;
+        float aaa21 = aa21 * m.a11 + aa22 * m.a21;
+        float aaa22 = aa21 * m.a12 + aa22 * m.a22;
+        m.s11 = Ts_ * (1.0f + h1 * m.a11 + h2 * aa11 + h3 * aaa11);
+        m.s12 = Ts_ * (h1 * m.a12 + h2 * aa12 + h3 * aaa12);
+        m.s21 = Ts_ * (h1 * m.a21 + h2 * aa21 + h3 * aaa21);
+        m.s22 = Ts_ * (1.0f + h1 * m.a22 + h2 * aa22 + h3 * aaa22);
+        return m;
+    }
+};
+
+#endif // __DEADBEAT_HPP
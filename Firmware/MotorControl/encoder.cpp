@@ -181,6 +181,7 @@ void Encoder::set_linear_count(int32_t count) {
 
     // Update states
     shadow_count_ = count;
+    pos_estimate_counts_split_ = {count, 0.0f};
     pos_estimate_counts_ = (float)count;
     /*tim_cnt_sample_：指的是利用定时中断定时更新采集的编码器统计数*/
     tim_cnt_sample_ = count;
@@ -873,8 +874,6 @@ bool Encoder::update() {
     /*如果速度估计很小，还会自动 snap 到 0，防止抖动。*/
     // run pll (for now pll is in units of encoder counts)
     // Predict current pos
-    /*整体位置估计（可能 > CPR，适合全局定位）*/
-    pos_estimate_counts_ += current_meas_period * vel_estimate_counts_;
     /*仅在 CPR 范围内的位置估计（周期性），用于电角度和控制*/
     pos_cpr_counts_      += current_meas_period * vel_estimate_counts_;
 
@@ -893,7 +892,19 @@ bool Encoder::update() {
     // discrete phase detector
     // 即离散相位检波器（计算实际 shadow_count_，count_in_cpr_ 和各自估计值的差值）
     // 或理解为计算位置误差（离散检测器）:比较预测位置与实际编码器值的差值。
-    float delta_pos_counts = (float)(shadow_count_ - encoder_model(pos_estimate_counts_));
+    /*整体位置估计以整数 + 小数的形式保存，所以远离零点时 floor 依然精确，
+    霍尔模式下只把 6 个计数以内的部分交给 hall_model*/
+    auto linear_model = [this](const SplitPosition& pos)->int32_t {
+        if (config_.mode == MODE_HALL) {
+            int32_t base_cnt = pos.integer - mod(pos.integer, 6);
+            return base_cnt + hall_model((float)(pos.integer - base_cnt) + pos.fraction);
+        }
+        return pos.integer;
+    };
+    /*整体位置估计（可能 > CPR，适合全局定位）：预测、检相和 PLL 反馈，见 encoder_pll.hpp*/
+    encoder_pll_update_linear(pos_estimate_counts_split_, vel_estimate_counts_, shadow_count_,
+                              linear_model, pll_kp_, current_meas_period);
+    pos_estimate_counts_ = pos_estimate_counts_split_.to_float();
     float delta_pos_cpr_counts = (float)(count_in_cpr_ - encoder_model(pos_cpr_counts_));
 
     /*计算位置误差（离散检测器）:比较预测位置与实际编码器值的差值。*/
@@ -907,7 +918,6 @@ bool Encoder::update() {
     // pll feedback（PLL 反馈：修正位置和速度）
     /**这是典型的 PI 控制结构，模仿锁相环的思想：位置偏差->修正估计位置（P），
     位置偏差积分->修正速度估计（I）这样既能保证跟踪精度，也具备一定滤波特性，抗抖动。*/
-    pos_estimate_counts_ += current_meas_period * pll_kp_ * delta_pos_counts;
     pos_cpr_counts_ += current_meas_period * pll_kp_ * delta_pos_cpr_counts;
     pos_cpr_counts_ = fmodf_pos(pos_cpr_counts_, (float)(config_.cpr));
     vel_estimate_counts_ += current_meas_period * pll_ki_ * delta_pos_cpr_counts;
@@ -919,7 +929,9 @@ bool Encoder::update() {
     }
 
     // Outputs from Encoder for Controller（编码器输出的可供使用的位置数据）
-    pos_estimate_ = pos_estimate_counts_ / (float)config_.cpr;
+    SplitPosition pos_estimate_split = pos_estimate_counts_split_.to_turns(config_.cpr);
+    pos_estimate_split_ = pos_estimate_split;
+    pos_estimate_ = pos_estimate_split.to_float();
     vel_estimate_ = vel_estimate_counts_ / (float)config_.cpr;
     
     // TODO: we should strictly require that this value is from the previous iteration
@@ -8,6 +8,8 @@ class Encoder;
 #include "utils.hpp"
 #include <autogen/interfaces.hpp>
 #include "component.hpp"
+#include "split_position.hpp"
+#include "encoder_pll.hpp"
 
 
 class Encoder : public ODriveIntf::EncoderIntf {
@@ -106,7 +108,8 @@ public:
     float interpolation_ = 0.0f;
     OutputPort<float> phase_ = 0.0f;     // [rad]，单位为弧度，方便 sin, cos 计算
     OutputPort<float> phase_vel_ = 0.0f; // [rad/s]
-    float pos_estimate_counts_ = 0.0f;  // [count]
+    SplitPosition pos_estimate_counts_split_;  // [count] PLL state, exact over the whole travel
+    float pos_estimate_counts_ = 0.0f;  // [count] float copy of pos_estimate_counts_split_
     float pos_cpr_counts_ = 0.0f;  // [count]
     float delta_pos_cpr_counts_ = 0.0f;  // [count] phase detector result for debug
     float vel_estimate_counts_ = 0.0f;  // [count/s]
@@ -117,6 +120,7 @@ public:
     float spi_error_rate_ = 0.0f;
 
     OutputPort<float> pos_estimate_ = 0.0f; // [turn]
+    OutputPort<SplitPosition> pos_estimate_split_ = SplitPosition{}; // [turn]
     OutputPort<float> vel_estimate_ = 0.0f; // [turn/s]
     OutputPort<float> pos_circular_ = 0.0f; // [turn]
 
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+#include "split_position.hpp"
+
+// Linear position part of the encoder PLL, in encoder counts.
+// The estimate is predicted with the velocity estimate and then pulled
+// towards the measured count by kp times the error of the discrete phase
+// detector. model(estimate) is the count the encoder would report at the
+// estimate (floor for incremental encoders, the hall model for halls).
+// Since the estimate is integer + fraction, neither step loses resolution
+// far away from zero.
+// Returns the phase detector error [count].
+template <typename TModel>
+inline float encoder_pll_update_linear(SplitPosition& pos_estimate, float vel_estimate, int32_t count,
+                                       TModel model, float kp, float dt) {
+    pos_estimate += dt * vel_estimate;
+    float delta = (float)(count - model(pos_estimate));
+    pos_estimate += dt * kp * delta;
+    return delta;
+}
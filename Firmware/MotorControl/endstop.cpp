@@ -13,6 +13,16 @@ void Endstop::update() {
         if (pin_state_ != last_pin_state)
             debounceTimer_.reset();
 
+        // The pin was released again before the edge was confirmed
+        if (pin_state_ != config_.is_active_high)
+            candidate_valid_ = false;
+
+        // Without EXTI the edge time is only known to within one control period
+        if (!edge_capture_ && pin_state_ != last_pin_state && pin_state_ == config_.is_active_high) {
+            capture_time_us_ = odrv.sampling_time_us_;
+            capture_pending_ = true;
+        }
+
         if (debounceTimer_.expired())
             endstop_state_ = config_.is_active_high ? pin_state_ : !pin_state_;  // endstop_state is the logical state
     } else {
@@ -20,7 +30,67 @@ void Endstop::update() {
     }
 }
 
+/*外部中断记录挡块触发时刻，用于精确锁存位置*/
+void Endstop::edge_cb() {
+    if (!capture_pending_) {
+        capture_time_us_ = micros();
+        capture_pending_ = true;
+    }
+}
+
+/**
+ * @brief Converts a pending edge capture into a position latch.
+ *
+ * Must be called from the control loop after the encoders are updated. The
+ * position estimate is linearly interpolated between the two samples around
+ * the edge time.
+ */
+void Endstop::update_capture() {
+    std::optional<float> pos = axis_->encoder_.pos_estimate_.present();
+    uint32_t now_us = odrv.sampling_time_us_;
+    if (!config_.enabled || !pos.has_value()) {
+        capture_pending_ = false;
+        candidate_valid_ = false;
+        prev_valid_ = false;
+        return;
+    }
+
+    // Later edges while the pin has not been seen released are bounces
+    if (capture_pending_) {
+        if (latch_armed_ && !candidate_valid_) {
+            float t = (float)(int32_t)(capture_time_us_ - now_us);
+            float dt = (float)(int32_t)(now_us - prev_time_us_);
+            float slope = (prev_valid_ && dt > 0.0f) ? (*pos - prev_pos_) / dt : 0.0f;
+            candidate_pos_ = *pos + t * slope;
+            candidate_valid_ = true;
+        }
+        capture_pending_ = false;
+    }
+
+    // Publish the edge once it has survived the debounce time
+    if (latch_armed_ && candidate_valid_ && rose()) {
+        latch_pos_ = candidate_pos_;
+        latched_ = true;
+        latch_armed_ = false;
+        candidate_valid_ = false;
+    }
+
+    prev_pos_ = *pos;
+    prev_time_us_ = now_us;
+    prev_valid_ = true;
+}
+
+void Endstop::arm_latch() {
+    CRITICAL_SECTION() {
+        latched_ = false;
+        capture_pending_ = false;
+        candidate_valid_ = false;
+        latch_armed_ = true;
+    }
+}
+
 bool Endstop::apply_config() {
+    config_.parent = this;
     debounceTimer_.reset();
     if (config_.enabled) {
         debounceTimer_.start();
@@ -28,5 +98,15 @@ bool Endstop::apply_config() {
         debounceTimer_.stop();
     }
     debounceTimer_.setIncrement(config_.debounce_ms * 0.001f);
+
+    if (edge_capture_) {
+        gpio_.unsubscribe();
+        edge_capture_ = false;
+    }
+    if (config_.enabled && config_.enable_edge_capture) {
+        // Falls back to polling if the EXTI line is already taken
+        gpio_ = get_gpio(config_.gpio_num);
+        edge_capture_ = gpio_.subscribe(config_.is_active_high, !config_.is_active_high, edge_cb_wrapper, this);
+    }
     return true;
 }
@@ -1,8 +1,10 @@
 #ifndef __ENDSTOP_HPP
 #define __ENDSTOP_HPP
 
+#include <autogen/interfaces.hpp>
 #include "timer.hpp"
-class Endstop {
+
+class Endstop : public ODriveIntf::EndstopIntf {
    public:
     struct Config_t {
         float offset = 0;
@@ -10,12 +12,17 @@ class Endstop {
         uint16_t gpio_num = 0;
         bool enabled = false;
         bool is_active_high = false;
+        // Timestamp edges with the EXTI instead of the control loop sample. The
+        // EXTI line (pin number) must not be shared with the step or index input.
+        bool enable_edge_capture = false;
 
         // custom setters
         Endstop* parent = nullptr;
         void set_gpio_num(uint16_t value) { gpio_num = value; parent->apply_config(); }
         void set_enabled(uint32_t value) { enabled = value; parent->apply_config(); }
         void set_debounce_ms(uint32_t value) { debounce_ms = value; parent->apply_config(); }
+        void set_is_active_high(bool value) { is_active_high = value; parent->apply_config(); }
+        void set_enable_edge_capture(bool value) { enable_edge_capture = value; parent->apply_config(); }
     };
 
 
@@ -25,6 +32,7 @@ class Endstop {
     bool apply_config();
 
     void update();
+    void update_capture();
     constexpr bool get_state(){
         return endstop_state_;
     }
@@ -37,12 +45,36 @@ class Endstop {
         return (endstop_state_ != last_state_) && !endstop_state_;
     }
 
+    // Touch probe latch: after arm_latch() the position estimate at the next
+    // active edge is stored in latch_pos_. latched_ is only set once the
+    // debounced state confirms that edge, glitches shorter than the debounce
+    // time are discarded.
+    void arm_latch();
+
     bool endstop_state_ = false;
+    bool latched_ = false;
+    float latch_pos_ = 0.0f;      // [turn] encoder position estimate interpolated to the edge time
+    bool edge_capture_ = false;   // true if edges are timestamped by the EXTI, false if the pin is polled
 
    private:
+    static void edge_cb_wrapper(void* ctx) {
+        reinterpret_cast<Endstop*>(ctx)->edge_cb();
+    }
+    void edge_cb();
+
     bool last_state_ = false;
     bool pin_state_ = false;
     float pos_when_pressed_ = 0.0f;
     Timer<float> debounceTimer_;
+
+    Stm32Gpio gpio_;                        // pin that is subscribed to the EXTI
+    volatile bool capture_pending_ = false;
+    volatile uint32_t capture_time_us_ = 0;
+    bool latch_armed_ = false;
+    bool candidate_valid_ = false;          // edge captured, waiting for the debounced state
+    float candidate_pos_ = 0.0f;            // [turn]
+    bool prev_valid_ = false;
+    float prev_pos_ = 0.0f;                 // [turn] position estimate of the previous sample
+    uint32_t prev_time_us_ = 0;             // [us] time of the previous sample
 };
-#endif
\ No newline at end of file
+#endif
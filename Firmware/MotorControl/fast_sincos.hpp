@@ -0,0 +1,60 @@
+#ifndef __FAST_SINCOS_HPP
+#define __FAST_SINCOS_HPP
+
+#include <cmath>
+#include <cstdint>
+
+struct SinCos {
+    float sin;
+    float cos;
+};
+
+/**
+ * @brief Computes sin(x) and cos(x) with one shared range reduction.
+ *
+ * x is reduced to r in [-pi/4, pi/4] and a quadrant, then both functions are
+ * evaluated with short minimax polynomials (max error about 1e-7 for
+ * |x| < 100, versus about 7e-5 for the 256-entry table of our_arm_sin_f32).
+ * No table is used, so there are no flash wait states on the lookup.
+ */
+inline SinCos fast_sincos(float x) {
+    constexpr float two_by_pi = 0.636619772368f;
+    constexpr float pi_by_2_hi = 1.5703125f;             // exact in float
+    constexpr float pi_by_2_lo = 4.83826794897e-4f;      // pi/2 - pi_by_2_hi
+
+    float fq = x * two_by_pi;
+    int32_t q = (int32_t)(fq + (fq >= 0.0f ? 0.5f : -0.5f));
+    float r = (x - (float)q * pi_by_2_hi) - (float)q * pi_by_2_lo;
+    float z = r * r;
+
+    float s = r + r * z * (-1.6666654611e-1f + z * (8.3321608736e-3f + z * -1.9515295891e-4f));
+    float c = 1.0f - 0.5f * z + z * z * (4.166664568298827e-2f + z * (-1.388731625493765e-3f + z * 2.443315711809948e-5f));
+
+    switch (q & 3) {
+        case 0: return {s, c};
+        case 1: return {c, -s};
+        case 2: return {-s, -c};
+        default: return {-c, s};
+    }
+}
+
+/**
+ * @brief Returns sin and cos of (x + delta) given sin and cos of x.
+ *
+ * Uses a truncated series for the rotation by delta, so it only applies to
+ * small angles: the error stays below 2e-6 for |delta| <= SMALL_ANGLE_MAX.
+ * Callers should fall back to fast_sincos() for larger steps.
+ */
+constexpr float SMALL_ANGLE_MAX = 0.5f; // [rad]
+
+inline SinCos rotate_sincos(const SinCos& sc, float delta) {
+    float z = delta * delta;
+    float s_d = delta * (1.0f - z * (1.0f / 6.0f) * (1.0f - z * (1.0f / 20.0f)));
+    float c_d = 1.0f - z * 0.5f * (1.0f - z * (1.0f / 12.0f) * (1.0f - z * (1.0f / 30.0f)));
+    return {
+        sc.sin * c_d + sc.cos * s_d,
+        sc.cos * c_d - sc.sin * s_d
+    };
+}
+
+#endif // __FAST_SINCOS_HPP
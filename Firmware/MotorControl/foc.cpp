@@ -11,6 +11,8 @@ Motor::Error AlphaBetaFrameController::on_measurement(
             uint32_t input_timestamp) {
 
     std::optional<float2D> Ialpha_beta;
+    vbus_voltage_ = vbus_voltage;
+    currents_ = currents;
 
     if (currents.has_value()) {
         /*Clarke transform（克拉克变换），one_by_sqrt3 为 1/√3 的近似值。*/
@@ -60,7 +62,7 @@ Motor::Error AlphaBetaFrameController::get_output(
         return Motor::ERROR_MODULATION_IS_NAN;
     }
 
-    auto [tA, tB, tC, success] = SVM(mod_alpha_beta->first, mod_alpha_beta->second);
+    auto [tA, tB, tC, success] = SVM(mod_alpha_beta->first, mod_alpha_beta->second, enable_overmodulation_);
     if (!success) {/*调制幅度错误*/
         return Motor::ERROR_MODULATION_MAGNITUDE;
     }
@@ -69,14 +71,59 @@ Motor::Error AlphaBetaFrameController::get_output(
     pwm_timings[1] = tB;
     pwm_timings[2] = tC;
 
+    if (enable_dead_time_comp_) {
+        compensate_dead_time(pwm_timings);
+    }
+
     return Motor::ERROR_NONE;
 }
 
+/**
+ * 死区及开关管压降补偿：死区时间内由续流二极管导通，相电压取决于相电流方向，
+ * 电流流出时相电压偏低，流入时偏高，低速时造成电流畸变。按各相电流方向修正 PWM 时序。
+ *
+ * The timings are the CCR fractions (PWM mode 2), so the high side on time
+ * is 1 - t. A phase current flowing out of the inverter loses
+ * dead_time_comp_ of on time and the switch drop, so t is reduced by the
+ * same amount, and the other way round. The sign of the most recent current
+ * measurement is used, with a linear ramp over +/-dead_time_comp_band_ so
+ * that the ripple around zero current does not toggle the compensation.
+ */
+void AlphaBetaFrameController::compensate_dead_time(float (&pwm_timings)[3]) {
+    if (!vbus_voltage_.has_value() || !currents_.has_value() || !(*vbus_voltage_ > 0.0f)) {
+        return;
+    }
+
+    float vbus_voltage = *vbus_voltage_;
+    float comp = dead_time_comp_ + switch_drop_comp_ / vbus_voltage;
+    float v_error[3];
+    for (size_t i = 0; i < 3; ++i) {
+        float sign = std::clamp((*currents_)[i] / dead_time_comp_band_, -1.0f, 1.0f);
+        float t = std::clamp(pwm_timings[i] - sign * comp, 0.0f, 1.0f);
+        // Part of the compensation that could not be applied [V]
+        v_error[i] = vbus_voltage * ((pwm_timings[i] - t) - sign * comp);
+        pwm_timings[i] = t;
+    }
+
+    // Clarke transform, the common mode part drops out
+    on_voltage_error(
+        (2.0f * v_error[0] - v_error[1] - v_error[2]) * (1.0f / 3.0f),
+        one_by_sqrt3 * (v_error[1] - v_error[2])
+    );
+}
+
+void FieldOrientedController::on_voltage_error(float v_alpha, float v_beta) {
+    final_v_alpha_ += v_alpha;
+    final_v_beta_ += v_beta;
+}
+
 void FieldOrientedController::reset() {
     v_current_control_integral_d_ = 0.0f;
     v_current_control_integral_q_ = 0.0f;
     vbus_voltage_measured_ = std::nullopt;
     Ialpha_beta_measured_ = std::nullopt;
+    mod_dq_valid_ = false;
+    deadbeat_.reset();
     power_ = 0.0f;
 }
 
@@ -87,6 +134,7 @@ Motor::Error FieldOrientedController::on_measurement(
     i_timestamp_ = input_timestamp;
     vbus_voltage_measured_ = vbus_voltage;
     Ialpha_beta_measured_ = Ialpha_beta;
+    mod_dq_valid_ = false;
 
     return Motor::ERROR_NONE;
 }
@@ -105,10 +153,6 @@ ODriveIntf::MotorIntf::Error FieldOrientedController::get_alpha_beta_output(
         return Motor::ERROR_BAD_TIMING;
     }
 
-    // TODO: improve efficiency in case PWM updates are requested at a higher
-    // rate than current sensor updates. In this case we can reuse mod_d and
-    // mod_q from a previous iteration.
-
     if (!Vdq_setpoint_.has_value()) {
         return Motor::ERROR_UNKNOWN_VOLTAGE_COMMAND;
     } else if (!phase_.has_value() || !phase_vel_.has_value()) {
@@ -117,9 +161,59 @@ ODriveIntf::MotorIntf::Error FieldOrientedController::get_alpha_beta_output(
         return Motor::ERROR_UNKNOWN_VBUS_VOLTAGE;
     }
 
-    auto [Vd, Vq] = *Vdq_setpoint_; /*获取 Vd, Vq（Motor 控制器输出的 d-q 轴电压指令）*/
     float phase = *phase_; /*获取当前电角度（弧度，由编码器或观测器估计）*/
     float phase_vel = *phase_vel_; /*获取电角速度*/
+
+    /*当前相位+角速度×时间差，即用线性预测法估算在当前采样时刻的电机角度（这是为了延迟补偿，补偿了电流采样与控制指令之间的时间延迟，提高当前相位准确度）*/
+    /*_timestamp_ - ctrl_timestamp_ 为当前采样时刻与控制器上一次更新时间的时间差（单位是定时器计数）。*/
+    float I_phase = phase + phase_vel * ((float)(int32_t)(i_timestamp_ - ctrl_timestamp_) / (float)TIM_1_8_CLOCK_HZ);
+    /*计算该角度的余弦和正弦值，Park 与反 Park 变换共用一次计算*/
+    SinCos sc_I = fast_sincos(I_phase);
+
+    // mod_d and mod_q only change with a new current measurement. If PWM
+    // updates are requested at a higher rate than current sensor updates, only
+    // the inverse Park transform to the new PWM phase is recomputed.
+    if (!mod_dq_valid_) {
+        Motor::Error err = update_modulation(sc_I);
+        if (err != Motor::ERROR_NONE) {
+            return err;
+        }
+        mod_dq_valid_ = true;
+    }
+    float mod_d = mod_d_;
+    float mod_q = mod_q_;
+
+    // Inverse park transform (反帕克变换 Inverse Park Transform)
+    // The PWM phase is the current sample phase advanced by the output delay,
+    // which is usually a small enough angle to rotate the Park sin/cos by.
+    float pwm_phase_delta = phase_vel * ((float)(int32_t)(output_timestamp - i_timestamp_) / (float)TIM_1_8_CLOCK_HZ);
+    SinCos sc_p = (std::abs(pwm_phase_delta) <= SMALL_ANGLE_MAX)
+                ? rotate_sincos(sc_I, pwm_phase_delta)
+                : fast_sincos(I_phase + pwm_phase_delta);
+    float c_p = sc_p.cos;
+    float s_p = sc_p.sin;
+    float mod_alpha = c_p * mod_d - s_p * mod_q;
+    float mod_beta = c_p * mod_q + s_p * mod_d;
+
+    // Report final applied voltage in stationary frame (for sensorless estimator)
+    final_v_alpha_ = mod_to_V_ * mod_alpha;
+    final_v_beta_ = mod_to_V_ * mod_beta;
+
+    /*Park 变换完成后，接下来如果我们以 Id, Iq 这两个值作为反馈控制的对象，
+    那么显然就可以使用一些线性控制器来进行控制了，比如 PID 没错工业界还是偏爱 PID，
+    尽管学术界有很多炫酷的高级控制方法*/
+    *mod_alpha_beta = {mod_alpha, mod_beta};
+
+    if (ibus_.has_value()) {
+        *ibus = ibus_;
+    }
+    
+    return Motor::ERROR_NONE;
+}
+
+/*Park 变换及电流环 PI 计算，每次电流采样只需计算一次，结果保存在 mod_d_, mod_q_*/
+ODriveIntf::MotorIntf::Error FieldOrientedController::update_modulation(const SinCos& sc_I) {
+    auto [Vd, Vq] = *Vdq_setpoint_; /*获取 Vd, Vq（Motor 控制器输出的 d-q 轴电压指令）*/
     float vbus_voltage = *vbus_voltage_measured_; /*获取母线电压（用于 PWM 归一化）*/
 
     std::optional<float2D> Idq;
@@ -127,12 +221,8 @@ ODriveIntf::MotorIntf::Error FieldOrientedController::get_alpha_beta_output(
     // Park transform (帕克变换 Park Transform)
     if (Ialpha_beta_measured_.has_value()) {
         auto [Ialpha, Ibeta] = *Ialpha_beta_measured_;
-        /*当前相位+角速度×时间差，即用线性预测法估算在当前采样时刻的电机角度（这是为了延迟补偿，补偿了电流采样与控制指令之间的时间延迟，提高当前相位准确度）*/
-        /*_timestamp_ - ctrl_timestamp_ 为当前采样时刻与控制器上一次更新时间的时间差（单位是定时器计数）。*/
-        float I_phase = phase + phase_vel * ((float)(int32_t)(i_timestamp_ - ctrl_timestamp_) / (float)TIM_1_8_CLOCK_HZ);
-        /*计算该角度的余弦和正弦值，通常用于生成三相电流控制信号。*/
-        float c_I = our_arm_cos_f32(I_phase);
-        float s_I = our_arm_sin_f32(I_phase);
+        float c_I = sc_I.cos;
+        float s_I = sc_I.sin;
 
         /*Park 变换公式：Id = Ialpha*cos(θ)+Ibeta*sin(θ)*/
         /*Iq = -Ialpha*sin(θ)+Ibeta*cos(θ)*/
@@ -176,21 +266,45 @@ ODriveIntf::MotorIntf::Error FieldOrientedController::get_alpha_beta_output(
         float Ierr_d = Id_setpoint - Id;
         float Ierr_q = Iq_setpoint - Iq;
 
-        // 电流闭环控制，这部分计算是 PI 电流控制器的输出，基于 Id 和 Iq 的 PI 控制（这里才是真正的电流/力矩环实现）。
-        // Apply PI control (V{d,q}_setpoint act as feed-forward terms in this mode)
-        mod_d = V_to_mod * (Vd + v_current_control_integral_d_ + Ierr_d * p_gain);
-        mod_q = V_to_mod * (Vq + v_current_control_integral_q_ + Ierr_q * p_gain);
+        if (enable_deadbeat_) {
+            // 无差拍预测电流控制：由电机模型计算使电流在下一个输出周期结束时到达设定值所需的电压。
+            // The model already contains the R, w*L and bEMF terms, so the
+            // V{d,q}_setpoint feed-forward is not added. The integrator only
+            // takes out the steady state error of model mismatch.
+            auto [Vd_db, Vq_db] = deadbeat_.get_voltage({Id, Iq}, {Id_setpoint, Iq_setpoint}, *phase_vel_);
+            mod_d = V_to_mod * (Vd_db + v_current_control_integral_d_);
+            mod_q = V_to_mod * (Vq_db + v_current_control_integral_q_);
+        } else {
+            // 电流闭环控制，这部分计算是 PI 电流控制器的输出，基于 Id 和 Iq 的 PI 控制（这里才是真正的电流/力矩环实现）。
+            // Apply PI control (V{d,q}_setpoint act as feed-forward terms in this mode)
+            mod_d = V_to_mod * (Vd + v_current_control_integral_d_ + Ierr_d * p_gain);
+            mod_q = V_to_mod * (Vq + v_current_control_integral_q_ + Ierr_q * (p_gain * p_gain_q_scale_));
+        }
 
         // Vector modulation saturation, lock integrator if saturated
-        // TODO make maximum modulation configurable
-        // 0.80f * sqrt3_by_2: 设置调制上限（80% 的六边形极限）
-        float mod_scalefactor = 0.80f * sqrt3_by_2 * 1.0f / std::sqrt(mod_d * mod_d + mod_q * mod_q);
+        // max_modulation_ * sqrt3_by_2: 设置调制上限（默认 80% 的六边形内切圆，过调制时可超过内切圆）
+        float mod_scalefactor = max_modulation_ * sqrt3_by_2 / std::sqrt(mod_d * mod_d + mod_q * mod_q);
         if (mod_scalefactor < 1.0f) {
             mod_d *= mod_scalefactor;
             mod_q *= mod_scalefactor;
             // TODO make decayfactor configurable（积分项衰减，防积分饱和）
             v_current_control_integral_d_ *= 0.99f;
             v_current_control_integral_q_ *= 0.99f;
+        } else if (enable_complex_vector_ && !enable_deadbeat_) {
+            // Complex vector regulator: the integrator also carries the
+            // j*w*L cross-coupling, which places the controller zero on the
+            // plant pole -(R + j*w*L)/L instead of -R/L. The cross-coupling
+            // is then cancelled inside the loop at any speed, rather than by
+            // the R_wL feedforward that is computed from the setpoint.
+            // The phase advance of the output (1.5 PWM periods, see
+            // get_alpha_beta_output()) keeps the d/q axes of the applied
+            // voltage aligned with those of the measurement.
+            /*复矢量电流调节器：积分项包含 jωL 交叉耦合，控制器零点与被控对象极点 -(R+jωL)/L 对消，高速时两轴解耦*/
+            float w = *phase_vel_;
+            float cross_d = -w * p_gain * p_gain_q_scale_ * Ierr_q; // -w * Lq * bandwidth * Ierr_q
+            float cross_q = w * p_gain * Ierr_d;                   //  w * Ld * bandwidth * Ierr_d
+            v_current_control_integral_d_ += (Ierr_d * i_gain + cross_d) * current_meas_period;
+            v_current_control_integral_q_ += (Ierr_q * i_gain + cross_q) * current_meas_period;
         } else {
             v_current_control_integral_d_ += Ierr_d * (i_gain * current_meas_period);
             v_current_control_integral_q_ += Ierr_q * (i_gain * current_meas_period);
@@ -203,29 +317,22 @@ ODriveIntf::MotorIntf::Error FieldOrientedController::get_alpha_beta_output(
         mod_q = V_to_mod * Vq;
     }
 
-    // Inverse park transform (反帕克变换 Inverse Park Transform)
-    float pwm_phase = phase + phase_vel * ((float)(int32_t)(output_timestamp - ctrl_timestamp_) / (float)TIM_1_8_CLOCK_HZ);
-    float c_p = our_arm_cos_f32(pwm_phase);
-    float s_p = our_arm_sin_f32(pwm_phase);
-    float mod_alpha = c_p * mod_d - s_p * mod_q;
-    float mod_beta = c_p * mod_q + s_p * mod_d;
+    mod_to_V_ = mod_to_V;
+    mod_d_ = mod_d;
+    mod_q_ = mod_q;
 
-    // Report final applied voltage in stationary frame (for sensorless estimator)
-    final_v_alpha_ = mod_to_V * mod_alpha;
-    final_v_beta_ = mod_to_V * mod_beta;
-
-    /*Park 变换完成后，接下来如果我们以 Id, Iq 这两个值作为反馈控制的对象，
-    那么显然就可以使用一些线性控制器来进行控制了，比如 PID 没错工业界还是偏爱 PID，
-    尽管学术界有很多炫酷的高级控制方法*/
-    *mod_alpha_beta = {mod_alpha, mod_beta};
+    // The deadbeat prediction needs the voltage that is actually output
+    deadbeat_.set_applied_voltage({mod_to_V * mod_d, mod_to_V * mod_q});
 
     if (Idq.has_value()) {
         auto [Id, Iq] = *Idq;
         /*额外计算 Ibus 母线电流估计，用于功率计算、效率分析、过流保护*/
-        *ibus = mod_d * Id + mod_q * Iq;
-        power_ = vbus_voltage * (*ibus).value();
+        ibus_ = mod_d * Id + mod_q * Iq;
+        power_ = vbus_voltage * ibus_.value();
+    } else {
+        ibus_ = std::nullopt;
     }
-    
+
     return Motor::ERROR_NONE;
 }
 
@@ -3,6 +3,8 @@
 
 #include "phase_control_law.hpp"
 #include "component.hpp"
+#include "fast_sincos.hpp"
+#include "deadbeat.hpp"
 
 /**
  * @brief Field oriented controller.
@@ -28,7 +30,12 @@ public:
 
     // Config - these values are set while this controller is inactive
     std::optional<float2D> pi_gains_; // [V/A, V/As] should be auto set after resistance and inductance measurement
+    float p_gain_q_scale_ = 1.0f; // Lq / Ld, the q axis proportional gain is pi_gains_->first * p_gain_q_scale_
+    bool enable_complex_vector_ = false; // decouple the d and q axes inside the current controller
+    bool enable_deadbeat_ = false; // use deadbeat_ instead of the PI controller (current control mode only)
+    DeadbeatCurrentRegulator deadbeat_;
     float I_measured_report_filter_k_ = 1.0f;
+    float max_modulation_ = 0.80f; // fraction of the linear SVM range
 
     // Inputs
     bool enable_current_control_src_ = false;
@@ -54,13 +61,18 @@ public:
     float Iq_measured_; // [A]
     float v_current_control_integral_d_ = 0.0f; // [V]
     float v_current_control_integral_q_ = 0.0f; // [V]
-    //float mod_to_V_ = 0.0f;
-    //float mod_d_ = 0.0f;
-    //float mod_q_ = 0.0f;
-    //float ibus_ = 0.0f;
+    bool mod_dq_valid_ = false; // false until mod_d_ and mod_q_ are computed from the latest measurement
+    float mod_to_V_ = 0.0f;
+    float mod_d_ = 0.0f;
+    float mod_q_ = 0.0f;
+    std::optional<float> ibus_; // [A]
     float final_v_alpha_ = 0.0f; // [V]
     float final_v_beta_ = 0.0f; // [V]
     float power_ = 0.0f; // [W] dot product of Vdq and Idq
+
+private:
+    void on_voltage_error(float v_alpha, float v_beta) final;
+    ODriveIntf::MotorIntf::Error update_modulation(const SinCos& sc_I);
 };
 
 #endif // __FOC_HPP
\ No newline at end of file
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+// Zero-vibration input shaper.
+// Convolves a setpoint (position, velocity and torque feed-forward) with a
+// short sequence of impulses so that a lightly damped mode at the configured
+// frequency is not excited. The delay line is decimated so that shaping low
+// frequencies does not need one entry per control loop iteration; delayed
+// values are linearly interpolated between entries.
+class InputShaper {
+   public:
+    enum Type {
+        TYPE_NONE = 0,
+        TYPE_ZV = 1,   // 2 impulses, shortest delay (half a period)
+        TYPE_ZVD = 2,  // 3 impulses, more robust to frequency error
+        TYPE_EI = 3,   // 3 impulses, extra insensitive (5% vibration tolerance)
+    };
+
+    struct Sample {
+        float pos;     // [turns]
+        float vel;     // [turn/s]
+        float torque;  // [Nm]
+    };
+
+    static constexpr size_t MAX_IMPULSES = 3;
+    static constexpr size_t HISTORY_SIZE = 128;
+
+    // @param frequency: frequency of the mode to suppress [Hz]
+    // @param damping: damping ratio of that mode (0 <= damping < 1)
+    // @param sample_period: period at which update() is called [s]
+    // Returns false and disables shaping if the parameters are out of range.
+    bool configure(Type type, float frequency, float damping, float sample_period) {
+        n_impulses_ = 0;
+        if (type == TYPE_NONE || !(frequency > 0.0f) || !(damping >= 0.0f && damping < 1.0f) || !(sample_period > 0.0f)) {
+            return false;
+        }
+
+        float root = std::sqrt(1.0f - damping * damping);
+        float half_period = 0.5f / (frequency * root);  // [s] half damped period
+        float K = std::exp(-damping * static_cast<float>(M_PI) / root);
+
+        if (type == TYPE_ZV) {
+            float norm = 1.0f / (1.0f + K);
+            amplitude_[0] = norm;
+            amplitude_[1] = K * norm;
+            n_impulses_ = 2;
+        } else if (type == TYPE_ZVD) {
+            float norm = 1.0f / ((1.0f + K) * (1.0f + K));
+            amplitude_[0] = norm;
+            amplitude_[1] = 2.0f * K * norm;
+            amplitude_[2] = K * K * norm;
+            n_impulses_ = 3;
+        } else if (type == TYPE_EI) {
+            // Undamped EI amplitudes (1+V)/4, (1-V)/2, (1+V)/4, weighted by
+            // K per half period like ZV and ZVD to account for damping
+            const float V = 0.05f;  // tolerable residual vibration
+            float a0 = 0.25f * (1.0f + V);
+            float a1 = 0.5f * (1.0f - V) * K;
+            float a2 = 0.25f * (1.0f + V) * K * K;
+            float norm = 1.0f / (a0 + a1 + a2);
+            amplitude_[0] = a0 * norm;
+            amplitude_[1] = a1 * norm;
+            amplitude_[2] = a2 * norm;
+            n_impulses_ = 3;
+        } else {
+            return false;
+        }
+
+        for (size_t i = 0; i < n_impulses_; ++i) {
+            delay_[i] = (uint32_t)std::lround(i * half_period / sample_period);
+        }
+        uint32_t max_delay = delay_[n_impulses_ - 1];
+        decimation_ = std::max<uint32_t>(1, (max_delay + HISTORY_SIZE - 3) / (HISTORY_SIZE - 2));
+        return true;
+    }
+
+    bool enabled() const {
+        return n_impulses_ > 0;
+    }
+
+    // Number of update() calls after which the output has caught up with a
+    // constant input
+    uint32_t settling_ticks() const {
+        return enabled() ? delay_[n_impulses_ - 1] + decimation_ : 0;
+    }
+
+    // Fills the delay line with a constant setpoint.
+    void reset(const Sample& sample) {
+        for (auto& entry : history_)
+            entry = sample;
+        head_ = 0;
+        tick_ = 0;
+    }
+
+    // Moves all stored positions by -offset, used to rebase the positions
+    // onto a new origin without disturbing the output.
+    void shift_pos(float offset) {
+        for (auto& entry : history_)
+            entry.pos -= offset;
+    }
+
+    Sample update(const Sample& in) {
+        if (tick_ == 0) {
+            head_ = (head_ + 1) % HISTORY_SIZE;
+            history_[head_] = in;
+        }
+
+        Sample out = {0.0f, 0.0f, 0.0f};
+        for (size_t i = 0; i < n_impulses_; ++i) {
+            Sample delayed = lookup(in, delay_[i]);
+            out.pos += amplitude_[i] * delayed.pos;
+            out.vel += amplitude_[i] * delayed.vel;
+            out.torque += amplitude_[i] * delayed.torque;
+        }
+
+        tick_ = (tick_ + 1) % decimation_;
+        return out;
+    }
+
+   private:
+    static Sample lerp(const Sample& a, const Sample& b, float frac) {
+        return {a.pos + frac * (b.pos - a.pos),
+                a.vel + frac * (b.vel - a.vel),
+                a.torque + frac * (b.torque - a.torque)};
+    }
+
+    // Returns the input as it was delay ticks ago. The newest history entry
+    // is tick_ ticks old, entry j is tick_ + j * decimation_ ticks old.
+    Sample lookup(const Sample& in, uint32_t delay) const {
+        if (delay < tick_) {
+            return lerp(in, history_[head_], (float)delay / (float)tick_);
+        }
+        uint32_t j = (delay - tick_) / decimation_;
+        float frac = (float)(delay - tick_ - j * decimation_) / (float)decimation_;
+        const Sample& newer = history_[(head_ + HISTORY_SIZE - j) % HISTORY_SIZE];
+        const Sample& older = history_[(head_ + HISTORY_SIZE - j - 1) % HISTORY_SIZE];
+        return lerp(newer, older, frac);
+    }
+
+    float amplitude_[MAX_IMPULSES] = {};
+    uint32_t delay_[MAX_IMPULSES] = {};  // [control loop ticks]
+    size_t n_impulses_ = 0;
+
+    Sample history_[HISTORY_SIZE] = {};
+    size_t head_ = 0;
+    uint32_t tick_ = 0;         // ticks since the newest history entry
+    uint32_t decimation_ = 1;   // ticks between history entries
+};
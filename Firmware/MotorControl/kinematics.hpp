@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+// Linear kinematics of mechanisms where two motors jointly drive two joints.
+// Motor positions are M * joint positions, where M is:
+//
+//   CoreXY / H-bot:  A = X + Y, B = X - Y
+//   Differential:    A = pitch + roll, B = -pitch + roll
+//   Custom:          config.matrix (row major)
+//
+// scaled by config.scale [motor turns per joint unit]. CoreXY and H-bot only
+// differ in belt routing (and thus racking), not in their ideal kinematics.
+class Kinematics {
+   public:
+    enum Type {
+        TYPE_NONE = 0,
+        TYPE_COREXY = 1,
+        TYPE_HBOT = 2,
+        TYPE_DIFFERENTIAL = 3,
+        TYPE_CUSTOM = 4,
+    };
+
+    struct Config_t {
+        uint8_t type = TYPE_NONE;                   // see Kinematics::Type
+        float scale = 1.0f;                         // [motor turns / joint unit]
+        float matrix[4] = {1.0f, 0.0f, 0.0f, 1.0f}; // used by TYPE_CUSTOM, applied by the setters below or on startup
+
+        // custom setters
+        Kinematics* parent = nullptr;
+        void set_type(uint8_t value) { type = value; parent->configure(*this); }
+        void set_scale(float value) { scale = value; parent->configure(*this); }
+        void set_matrix0(float value) { matrix[0] = value; parent->configure(*this); }
+        void set_matrix1(float value) { matrix[1] = value; parent->configure(*this); }
+        void set_matrix2(float value) { matrix[2] = value; parent->configure(*this); }
+        void set_matrix3(float value) { matrix[3] = value; parent->configure(*this); }
+    };
+
+    // Applies config and routes its setters to this object
+    bool apply_config(Config_t& config) {
+        config.parent = this;
+        configure(config);
+        return true;
+    }
+
+    // Returns false if the transform is disabled or M is singular.
+    bool configure(const Config_t& config) {
+        enabled_ = false;
+        const float* m;
+        static const float corexy[4] = {1.0f, 1.0f, 1.0f, -1.0f};
+        static const float differential[4] = {1.0f, 1.0f, -1.0f, 1.0f};
+        switch (config.type) {
+            case TYPE_COREXY:
+            case TYPE_HBOT: m = corexy; break;
+            case TYPE_DIFFERENTIAL: m = differential; break;
+            case TYPE_CUSTOM: m = config.matrix; break;
+            default: return false;
+        }
+
+        for (int i = 0; i < 4; ++i)
+            m_[i] = config.scale * m[i];
+        float det = m_[0] * m_[3] - m_[1] * m_[2];
+        if (!(std::abs(det) > 1e-9f))
+            return false;
+        inv_[0] = m_[3] / det;
+        inv_[1] = -m_[1] / det;
+        inv_[2] = -m_[2] / det;
+        inv_[3] = m_[0] / det;
+        enabled_ = true;
+        return true;
+    }
+
+    bool enabled() const {
+        return enabled_;
+    }
+
+    // Joint positions or velocities to motor positions or velocities
+    void to_motor(const float joint[2], float motor[2]) const {
+        mul(m_, joint, motor);
+    }
+
+    // Motor positions or velocities to joint positions or velocities
+    void to_joint(const float motor[2], float joint[2]) const {
+        mul(inv_, motor, joint);
+    }
+
+    // Joint forces to motor torques. By virtual work the torques are M^-T * forces.
+    void force_to_torque(const float force[2], float torque[2]) const {
+        torque[0] = inv_[0] * force[0] + inv_[2] * force[1];
+        torque[1] = inv_[1] * force[0] + inv_[3] * force[1];
+    }
+
+   private:
+    static void mul(const float m[4], const float in[2], float out[2]) {
+        out[0] = m[0] * in[0] + m[1] * in[1];
+        out[1] = m[2] * in[0] + m[3] * in[1];
+    }
+
+    bool enabled_ = false;
+    float m_[4] = {1.0f, 0.0f, 0.0f, 1.0f};
+    float inv_[4] = {1.0f, 0.0f, 0.0f, 1.0f};
+};
@@ -99,7 +99,9 @@ static bool config_read_all() {
                   config_manager.read(&axes[i].trap_traj_.config_) &&
                   config_manager.read(&axes[i].min_endstop_.config_) &&
                   config_manager.read(&axes[i].max_endstop_.config_) &&
+                  config_manager.read(&axes[i].probe_.config_) &&
                   config_manager.read(&axes[i].mechanical_brake_.config_) &&
+                  config_manager.read(&axes[i].position_compare_.config_) &&
                   config_manager.read(&motors[i].config_) &&
                   config_manager.read(&motors[i].fet_thermistor_.config_) &&
                   config_manager.read(&motors[i].motor_thermistor_.config_) &&
@@ -119,7 +121,9 @@ static bool config_write_all() {
                   config_manager.write(&axes[i].trap_traj_.config_) &&
                   config_manager.write(&axes[i].min_endstop_.config_) &&
                   config_manager.write(&axes[i].max_endstop_.config_) &&
+                  config_manager.write(&axes[i].probe_.config_) &&
                   config_manager.write(&axes[i].mechanical_brake_.config_) &&
+                  config_manager.write(&axes[i].position_compare_.config_) &&
                   config_manager.write(&motors[i].config_) &&
                   config_manager.write(&motors[i].fet_thermistor_.config_) &&
                   config_manager.write(&motors[i].motor_thermistor_.config_) &&
@@ -140,7 +144,9 @@ static void config_clear_all() {
         axes[i].trap_traj_.config_ = {};
         axes[i].min_endstop_.config_ = {};
         axes[i].max_endstop_.config_ = {};
+        axes[i].probe_.config_ = {};
         axes[i].mechanical_brake_.config_ = {};
+        axes[i].position_compare_.config_ = {};
         motors[i].config_ = {};
         motors[i].fet_thermistor_.config_ = {};
         motors[i].motor_thermistor_.config_ = {};
@@ -149,12 +155,15 @@ static void config_clear_all() {
 }
 
 static bool config_apply_all() {
-    bool success = odrv.can_.apply_config();
+    bool success = odrv.can_.apply_config()
+                && odrv.kinematics_.apply_config(odrv.config_.kinematics);
     for (size_t i = 0; (i < AXIS_COUNT) && success; ++i) {
         success = encoders[i].apply_config(motors[i].config_.motor_type)
                && axes[i].controller_.apply_config()
                && axes[i].min_endstop_.apply_config()
                && axes[i].max_endstop_.apply_config()
+               && axes[i].probe_.apply_config()
+               && axes[i].position_compare_.apply_config()
                && motors[i].apply_config()
                && motors[i].motor_thermistor_.apply_config()
                && axes[i].apply_config();
@@ -347,6 +356,7 @@ void ODrive::disarm_with_error(Error error) {
  */
 void ODrive::sampling_cb() {
     n_evt_sampling_++;
+    sampling_time_us_ = micros();
 
     MEASURE_TIME(task_times_.sampling) {
         for (auto& axis: axes) {
@@ -355,6 +365,168 @@ void ODrive::sampling_cb() {
     }
 }
 
+/**
+ * @brief Requests a trajectory move of all axes that starts and finishes on
+ * the same control loop tick.
+ * 
+ * All axes must be in closed loop control. The move is planned at the
+ * beginning of the next control loop iteration (from the then-current
+ * setpoints) and executed by update_coordinated_move().
+ * 
+ * @param goal_points: Target position of each axis [turns]
+ */
+bool ODrive::move_to_pos_coordinated(std::array<float, AXIS_COUNT> goal_points) {
+    for (auto& axis: axes) {
+        if (axis.current_state_ != Axis::AXIS_STATE_CLOSED_LOOP_CONTROL) {
+            return false;
+        }
+    }
+
+    CRITICAL_SECTION() {
+        for (size_t i = 0; i < AXIS_COUNT; ++i) {
+            Controller& controller = axes[i].controller_;
+            controller.config_.input_mode = Controller::INPUT_MODE_TRAP_TRAJ;
+            controller.config_.control_mode = Controller::CONTROL_MODE_POSITION_CONTROL;
+            controller.input_pos_ = goal_points[i];
+            controller.input_pos_updated_ = false; // the plan below replaces any pending single-axis move
+        }
+        coordinated_goal_points_ = goal_points;
+        coordinated_move_pending_ = true;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Sets a joint space setpoint for the mechanism configured in
+ * config_.kinematics.
+ * 
+ * The setpoint is transformed to motor space and handed to both controllers
+ * on the same control loop tick by update_kinematics(). The controllers keep
+ * their input and control modes, so this works with any input mode that
+ * uses input_pos, input_vel and input_torque.
+ * 
+ * @param pos: Joint positions [joint unit]
+ * @param vel: Joint velocity feed-forward [joint unit/s]
+ * @param force: Joint force feed-forward
+ */
+bool ODrive::set_kinematics_input(std::array<float, 2> pos, std::array<float, 2> vel, std::array<float, 2> force) {
+    static_assert(AXIS_COUNT == 2, "kinematic transforms expect two axes");
+    if (!kinematics_.enabled()) {
+        return false;
+    }
+
+    CRITICAL_SECTION() {
+        kinematics_input_pos_ = pos;
+        kinematics_input_vel_ = vel;
+        kinematics_input_force_ = force;
+        kinematics_input_pending_ = true;
+    }
+    return true;
+}
+
+/**
+ * @brief Maps pending joint space setpoints to the motor axes and the motor
+ * estimates back to joint space.
+ * 
+ * Must be called from control_loop_cb() after both encoders are updated and
+ * before the controllers are updated.
+ */
+void ODrive::update_kinematics() {
+    if (!kinematics_.enabled()) {
+        kinematics_input_pending_ = false;
+        return;
+    }
+
+    // Joint space estimates, using the same estimates as the controllers (load encoder aware)
+    std::optional<float> pos0 = axes[0].controller_.pos_estimate_linear_src_.present();
+    std::optional<float> pos1 = axes[1].controller_.pos_estimate_linear_src_.present();
+    std::optional<float> vel0 = axes[0].controller_.vel_estimate_src_.present();
+    std::optional<float> vel1 = axes[1].controller_.vel_estimate_src_.present();
+    if (pos0.has_value() && pos1.has_value()) {
+        float motor[2] = {*pos0, *pos1};
+        kinematics_.to_joint(motor, kinematics_pos_estimate_.data());
+    }
+    if (vel0.has_value() && vel1.has_value()) {
+        float motor[2] = {*vel0, *vel1};
+        kinematics_.to_joint(motor, kinematics_vel_estimate_.data());
+    }
+
+    if (kinematics_input_pending_) {
+        kinematics_input_pending_ = false;
+
+        float pos[2], vel[2], torque[2];
+        kinematics_.to_motor(kinematics_input_pos_.data(), pos);
+        kinematics_.to_motor(kinematics_input_vel_.data(), vel);
+        kinematics_.force_to_torque(kinematics_input_force_.data(), torque);
+        for (size_t i = 0; i < 2; ++i) {
+            Controller& controller = axes[i].controller_;
+            controller.set_input_pos_and_steps(pos[i]);
+            controller.input_vel_ = vel[i];
+            controller.input_torque_ = torque[i];
+            controller.input_pos_updated();
+        }
+    }
+}
+
+/**
+ * @brief Plans a pending coordinated move.
+ * 
+ * One trapezoidal path profile s(t) from 0 to 1 is planned for the whole
+ * move, with limits such that no axis exceeds its own trap_traj.config
+ * limits. Each axis follows start_i + D_i * s(t), so the axes start and
+ * finish on the same tick and the combined motion is a straight line.
+ * If the axes are already moving, the profile starts with the component of
+ * their velocity along the path.
+ * 
+ * Must be called from control_loop_cb() before the controllers are updated.
+ */
+void ODrive::update_coordinated_move() {
+    if (!coordinated_move_pending_) {
+        return;
+    }
+    coordinated_move_pending_ = false;
+
+    std::array<float, AXIS_COUNT> distance;
+    float Vmax = INFINITY, Amax = INFINITY, Dmax = INFINITY;
+    float dot_vel = 0.0f, dot_dist = 0.0f;
+    for (size_t i = 0; i < AXIS_COUNT; ++i) {
+        Controller& controller = axes[i].controller_;
+        TrapezoidalTrajectory& traj = axes[i].trap_traj_;
+        // Trajectories are planned relative to the current setpoint, see
+        // Controller::move_to_pos(). With input shaping that is the unshaped
+        // one, the shaped setpoint lags behind.
+        controller.sync_split_positions();
+        controller.trajectory_origin_ = controller.unshaped_pos_setpoint();
+        distance[i] = SplitPosition::from_float(coordinated_goal_points_[i]) - controller.trajectory_origin_;
+
+        float abs_dist = std::abs(distance[i]);
+        if (abs_dist > 0.0f) {
+            Vmax = std::min(Vmax, traj.config_.vel_limit / abs_dist);
+            Amax = std::min(Amax, traj.config_.accel_limit / abs_dist);
+            Dmax = std::min(Dmax, traj.config_.decel_limit / abs_dist);
+        }
+        dot_vel += distance[i] * controller.unshaped_vel_setpoint();
+        dot_dist += distance[i] * distance[i];
+    }
+
+    TrapezoidalTrajectory path;
+    if (dot_dist > 0.0f) {
+        path.planTrapezoidal(1.0f, 0.0f, dot_vel / dot_dist, Vmax, Amax, Dmax);
+    } else {
+        path.planTrapezoidal(0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f); // nothing to move
+    }
+
+    for (size_t i = 0; i < AXIS_COUNT; ++i) {
+        Controller& controller = axes[i].controller_;
+        TrapezoidalTrajectory& traj = axes[i].trap_traj_;
+        traj.planScaled(path, 0.0f, distance[i]);
+        traj.t_ = 0.0f;
+        controller.trajectory_settle_ticks_ = 0;
+        controller.trajectory_done_ = false;
+    }
+}
+
 /**
  * @brief Runs the periodic control loop.
  * 
@@ -389,6 +561,7 @@ void ODrive::control_loop_cb(uint32_t timestamp) {
             axis.encoder_.phase_.reset();
             axis.encoder_.phase_vel_.reset();
             axis.encoder_.pos_estimate_.reset();
+            axis.encoder_.pos_estimate_split_.reset();
             axis.encoder_.vel_estimate_.reset();
             axis.encoder_.pos_circular_.reset();
             axis.motor_.Vdq_setpoint_.reset();
@@ -411,6 +584,7 @@ void ODrive::control_loop_cb(uint32_t timestamp) {
         MEASURE_TIME(axis.task_times_.endstop_update) {
             axis.min_endstop_.update();
             axis.max_endstop_.update();
+            axis.probe_.update();
         }
     }
 
@@ -439,9 +613,20 @@ void ODrive::control_loop_cb(uint32_t timestamp) {
             axis.encoder_.update();
     }
 
+    for (auto& axis: axes) {
+        axis.min_endstop_.update_capture();
+        axis.max_endstop_.update_capture();
+        axis.probe_.update_capture();
+        axis.position_compare_.update();
+    }
+
     // Controller of either axis might use the encoder estimate of the other
     // axis so we process both encoders before we continue.
 
+    update_kinematics();
+    motion_queue_.update();
+    update_coordinated_move();
+
     for (auto& axis: axes) {
         MEASURE_TIME(axis.task_times_.sensorless_estimator_update)
             axis.sensorless_estimator_.update();
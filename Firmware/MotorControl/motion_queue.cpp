@@ -0,0 +1,240 @@
+#include <odrive_main.h>
+
+/**
+ * 运动队列：G-code 行解析后放入队列，由控制回路逐条执行，
+ * 上位机不需要等待一条运动结束再发送下一条。
+ * 开始一条直线运动时查看队列中的下一条：两条运动在同一直线上时，
+ * 交界处不停止，以两者进给速度中较小的一个（且下一条能在其长度内停下）通过。
+ */
+
+bool MotionQueue::push(const Command_t* commands, size_t count) {
+    bool ok = false;
+    CRITICAL_SECTION() {
+        size_t used = (head_ + QUEUE_SIZE - tail_) % QUEUE_SIZE;
+        if (used + count < QUEUE_SIZE) {
+            for (size_t i = 0; i < count; ++i) {
+                queue_[head_] = commands[i];
+                head_ = (head_ + 1) % QUEUE_SIZE;
+            }
+            ok = true;
+        }
+    }
+    return ok;
+}
+
+void MotionQueue::clear() {
+    CRITICAL_SECTION() {
+        tail_ = head_;
+        active_ = false;
+        path_vel_ = 0.0f;
+    }
+}
+
+std::array<float, 2> MotionQueue::get_setpoint() {
+    float motor[2] = {axes[0].controller_.pos_setpoint_, axes[1].controller_.pos_setpoint_};
+    std::array<float, 2> joint = {motor[0], motor[1]};
+    if (odrv.kinematics_.enabled()) {
+        odrv.kinematics_.to_joint(motor, joint.data());
+    }
+    return joint;
+}
+
+void MotionQueue::write_setpoint(const std::array<float, 2>& pos, const std::array<float, 2>& vel) {
+    std::array<float, 2> motor_pos = pos;
+    std::array<float, 2> motor_vel = vel;
+    if (odrv.kinematics_.enabled()) {
+        odrv.kinematics_.to_motor(pos.data(), motor_pos.data());
+        odrv.kinematics_.to_motor(vel.data(), motor_vel.data());
+    }
+    for (size_t i = 0; i < 2; ++i) {
+        axes[i].controller_.set_input_pos_and_steps(motor_pos[i]);
+        axes[i].controller_.input_vel_ = motor_vel[i];
+        axes[i].controller_.input_torque_ = 0.0f;
+    }
+}
+
+/**
+ * @brief Executes queued commands back-to-back.
+ *
+ * Must be called from control_loop_cb() after update_kinematics() and before
+ * the controllers are updated. If an axis leaves closed loop control during a
+ * move, or a requested state change fails, the rest of the queue is dropped.
+ */
+void MotionQueue::update() {
+    if (!active_ && !start_next()) {
+        return;
+    }
+
+    if (step()) {
+        active_ = false;
+    }
+}
+
+// Pops the next command and starts it. Returns false if the queue is empty or
+// the command could not be started, in which case the queue is dropped.
+bool MotionQueue::start_next() {
+    if (head_ == tail_) {
+        return false;
+    }
+    command_ = queue_[tail_];
+    tail_ = (tail_ + 1) % QUEUE_SIZE;
+    if (!start(command_)) {
+        clear();
+        return false;
+    }
+    active_ = true;
+    return true;
+}
+
+bool MotionQueue::start(const Command_t& command) {
+    t_ = 0.0f;
+    state_requested_ = false;
+
+    switch (command.type) {
+        case COMMAND_MOVE: {
+            for (auto& axis: axes) {
+                if (axis.current_state_ != Axis::AXIS_STATE_CLOSED_LOOP_CONTROL) {
+                    return false;
+                }
+            }
+            float accel = odrv.config_.motion_queue.accel_limit;
+            if (!(accel > 0.0f)) {
+                return false;
+            }
+            // A move entered at a junction velocity starts at the target of
+            // the previous move, which step() has put into start_pos_
+            float v_start = path_vel_;
+            path_vel_ = 0.0f;
+            if (!(v_start > 0.0f)) {
+                start_pos_ = get_setpoint();
+            }
+            float dx = command.target[0] - start_pos_[0];
+            float dy = command.target[1] - start_pos_[1];
+            float length = std::sqrt(dx * dx + dy * dy);
+            direction_ = {0.0f, 0.0f};
+            if (length > 0.0f) {
+                direction_ = {dx / length, dy / length};
+            }
+            for (auto& axis: axes) {
+                axis.controller_.config_.control_mode = Controller::CONTROL_MODE_POSITION_CONTROL;
+                axis.controller_.config_.input_mode = Controller::INPUT_MODE_PASSTHROUGH;
+            }
+            // Look ahead one command for the junction velocity. If the next
+            // move arrives only after this one started, this one stops.
+            float v_end = 0.0f;
+            if (head_ != tail_ && queue_[tail_].type == COMMAND_MOVE) {
+                v_end = junction_velocity(start_pos_, command, queue_[tail_], accel);
+            }
+            profile_ = plan_profile(length, v_start, v_end, command.value, accel);
+        } break;
+
+        case COMMAND_HOME: {
+            for (auto& axis: axes) {
+                axis.requested_state_ = Axis::AXIS_STATE_HOMING;
+            }
+        } break;
+
+        case COMMAND_ENABLE: {
+            for (auto& axis: axes) {
+                if (axis.current_state_ != Axis::AXIS_STATE_CLOSED_LOOP_CONTROL) {
+                    axis.requested_state_ = Axis::AXIS_STATE_CLOSED_LOOP_CONTROL;
+                }
+            }
+            state_requested_ = true;
+        } break;
+
+        case COMMAND_DISABLE: {
+            for (auto& axis: axes) {
+                axis.requested_state_ = Axis::AXIS_STATE_IDLE;
+            }
+        } break;
+
+        default: break;
+    }
+    return true;
+}
+
+// Returns true once the active command is done
+bool MotionQueue::step() {
+    switch (command_.type) {
+        case COMMAND_MOVE: {
+            for (auto& axis: axes) {
+                if (axis.current_state_ != Axis::AXIS_STATE_CLOSED_LOOP_CONTROL) {
+                    clear();
+                    return true;
+                }
+            }
+            if (t_ >= profile_.duration) {
+                if (profile_.v_end > 0.0f && head_ != tail_ && queue_[tail_].type == COMMAND_MOVE) {
+                    // Continue into the next move within this tick, carrying
+                    // over the time already spent past the end of this one
+                    float t = t_ - profile_.duration;
+                    start_pos_ = command_.target;
+                    path_vel_ = profile_.v_end;
+                    if (!start_next()) {
+                        return true;
+                    }
+                    t_ = t;
+                    return step();
+                }
+                write_setpoint(command_.target, {0.0f, 0.0f});
+                return true;
+            }
+            float pos, vel;
+            eval_profile(profile_, t_, &pos, &vel);
+            write_setpoint({start_pos_[0] + direction_[0] * pos, start_pos_[1] + direction_[1] * pos},
+                           {direction_[0] * vel, direction_[1] * vel});
+            t_ += current_meas_period;
+            return false;
+        }
+
+        case COMMAND_DWELL: {
+            t_ += current_meas_period;
+            return t_ >= command_.value;
+        }
+
+        case COMMAND_HOME:
+        case COMMAND_ENABLE:
+        case COMMAND_DISABLE: {
+            // The axis state machine loads the task chain before it clears requested_state_
+            for (auto& axis: axes) {
+                if (axis.requested_state_ != Axis::AXIS_STATE_UNDEFINED
+                    || axis.current_state_ == Axis::AXIS_STATE_HOMING) {
+                    return false;
+                }
+            }
+            if (command_.type == COMMAND_DISABLE) {
+                return true;
+            }
+            if (command_.type == COMMAND_HOME && !state_requested_) {
+                for (auto& axis: axes) {
+                    if (!axis.homing_.is_homed) {
+                        // Homing failed or was aborted
+                        clear();
+                        return true;
+                    }
+                }
+            }
+
+            // Homing ends in idle, so re-enable closed loop control afterwards
+            if (!state_requested_) {
+                for (auto& axis: axes) {
+                    axis.requested_state_ = Axis::AXIS_STATE_CLOSED_LOOP_CONTROL;
+                }
+                state_requested_ = true;
+                return false;
+            }
+            for (auto& axis: axes) {
+                if (axis.current_state_ != Axis::AXIS_STATE_CLOSED_LOOP_CONTROL) {
+                    // The requested state failed
+                    clear();
+                    return true;
+                }
+            }
+            return true;
+        }
+
+        default:
+            return true;
+    }
+}
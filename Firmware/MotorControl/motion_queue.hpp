@@ -0,0 +1,238 @@
+#ifndef __MOTION_QUEUE_HPP
+#define __MOTION_QUEUE_HPP
+
+class Axis;
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+#include <communication/gcode.hpp>
+
+// Buffer of motion commands that are executed back-to-back from the control
+// loop, fed by the G-code subset of the ASCII protocol.
+// Positions are in joint space: with config.kinematics enabled X and Y are
+// the joints of the kinematic transform, otherwise they are the positions of
+// axis0 and axis1 in turns.
+class MotionQueue {
+   public:
+    static constexpr size_t QUEUE_SIZE = 16;
+    static constexpr float COLLINEAR_COS = 0.9999f;  // cos of the largest angle (about 0.8 deg) treated as a straight joint
+
+    struct Config_t {
+        float accel_limit = 10.0f;  // [unit/s^2] path acceleration and deceleration
+        float rapid_rate = 2.0f;    // [unit/s] path velocity of G0 moves
+    };
+
+    enum CommandType {
+        COMMAND_MOVE,     // G0 / G1
+        COMMAND_DWELL,    // G4
+        COMMAND_HOME,     // G28
+        COMMAND_ENABLE,   // M17
+        COMMAND_DISABLE,  // M18 / M84
+    };
+
+    struct Command_t {
+        CommandType type;
+        std::array<float, 2> target;  // [unit] COMMAND_MOVE
+        float value;                  // [unit/s] feed rate for COMMAND_MOVE, [s] for COMMAND_DWELL
+    };
+
+    // Modal state of the G-code interpreter
+    struct GCodeState_t {
+        std::array<float, 2> planned_pos = {};  // [unit] joint position the next queued move starts from
+        bool absolute = true;                   // G90 / G91
+        float feed_rate = 1.0f;                 // [unit/s] modal G1 feed rate
+    };
+
+    enum GCodeError {
+        GCODE_OK,
+        GCODE_NO_COMMAND,         // words but no G or M word, e.g. "N5 X10"
+        GCODE_UNSUPPORTED_G,
+        GCODE_UNSUPPORTED_M,
+        GCODE_INVALID_FEED_RATE,
+    };
+
+    static constexpr size_t MAX_LINE_COMMANDS = GCodeLine::MAX_G_CODES + 1;
+
+    // Translates one G-code line into queue commands: the G words in the order
+    // given, then the M word. M114 and M400 produce no command, the caller
+    // handles them. state is only updated if the whole line is valid. For
+    // unsupported words *code is set to the G or M number.
+    static GCodeError translate(const GCodeLine& line, GCodeState_t& state, float rapid_rate,
+                                Command_t* commands, size_t* num_commands, int* code) {
+        GCodeState_t s = state;
+        size_t n = 0;
+
+        if (line.num_g_codes == 0 && !line.has('M') && (line.present & ~(1u << ('N' - 'A')))) {
+            return GCODE_NO_COMMAND;
+        }
+
+        for (size_t i = 0; i < line.num_g_codes; ++i) {
+            switch (line.g_codes[i]) {
+                case 0:
+                case 1: {
+                    if (line.has('F')) {
+                        s.feed_rate = line.get('F', 0.0f) / 60.0f;
+                    }
+                    std::array<float, 2> target = s.planned_pos;
+                    const char letters[2] = {'X', 'Y'};
+                    for (size_t j = 0; j < 2; ++j) {
+                        if (line.has(letters[j])) {
+                            float value = line.get(letters[j], 0.0f);
+                            target[j] = s.absolute ? value : target[j] + value;
+                        }
+                    }
+                    float rate = line.g_codes[i] == 0 ? rapid_rate : s.feed_rate;
+                    if (!(rate > 0.0f)) {
+                        return GCODE_INVALID_FEED_RATE;
+                    }
+                    commands[n++] = {COMMAND_MOVE, target, rate};
+                    s.planned_pos = target;
+                } break;
+                case 4: {
+                    float duration = line.has('P') ? line.get('P', 0.0f) / 1000.0f : line.get('S', 0.0f);
+                    commands[n++] = {COMMAND_DWELL, {}, duration};
+                } break;
+                case 28: {
+                    commands[n++] = {COMMAND_HOME, {}, 0.0f};
+                    s.planned_pos = {0.0f, 0.0f};
+                } break;
+                case 90: s.absolute = true; break;
+                case 91: s.absolute = false; break;
+                default: {
+                    *code = line.g_codes[i];
+                    return GCODE_UNSUPPORTED_G;
+                }
+            }
+        }
+
+        if (line.has('M')) {
+            switch ((int)line.get('M', 0.0f)) {
+                case 17: commands[n++] = {COMMAND_ENABLE, {}, 0.0f}; break;
+                case 18:
+                case 84: commands[n++] = {COMMAND_DISABLE, {}, 0.0f}; break;
+                case 114:
+                case 400: break;
+                default: {
+                    *code = (int)line.get('M', 0.0f);
+                    return GCODE_UNSUPPORTED_M;
+                }
+            }
+        }
+
+        state = s;
+        *num_commands = n;
+        return GCODE_OK;
+    }
+
+    // Path velocity profile of one move: accelerate from v_start to v_cruise,
+    // cruise, decelerate to v_end. Positions are along the path, from 0 to length.
+    struct Profile_t {
+        float length = 0.0f;    // [unit]
+        float accel = 0.0f;     // [unit/s^2]
+        float v_start = 0.0f;   // [unit/s]
+        float v_cruise = 0.0f;  // [unit/s]
+        float v_end = 0.0f;     // [unit/s]
+        float t_accel = 0.0f;   // [s]
+        float t_cruise = 0.0f;  // [s]
+        float duration = 0.0f;  // [s]
+    };
+
+    // Plans a move that starts at v_start and ends at v_end. v_end is lowered
+    // if it can't be reached within length, and v_start must allow to slow
+    // down to v_end (the queue only starts moves at junction velocities that
+    // do, see junction_velocity()).
+    static Profile_t plan_profile(float length, float v_start, float v_end, float v_max, float accel) {
+        Profile_t p;
+        p.length = length;
+        p.accel = accel;
+        p.v_start = v_start;
+        p.v_end = std::min({v_end, v_max, std::sqrt(v_start * v_start + 2.0f * accel * length)});
+        // Velocity at which accelerating from v_start and decelerating to v_end meet
+        float v_peak = std::sqrt(accel * length + 0.5f * (v_start * v_start + p.v_end * p.v_end));
+        p.v_cruise = std::max({std::min(v_max, v_peak), v_start, p.v_end});
+        p.t_accel = (p.v_cruise - v_start) / accel;
+        float t_decel = (p.v_cruise - p.v_end) / accel;
+        float d_ramps = 0.5f * (v_start + p.v_cruise) * p.t_accel + 0.5f * (p.v_cruise + p.v_end) * t_decel;
+        p.t_cruise = (p.v_cruise > 0.0f) ? std::max(0.0f, (length - d_ramps) / p.v_cruise) : 0.0f;
+        p.duration = p.t_accel + p.t_cruise + t_decel;
+        return p;
+    }
+
+    static void eval_profile(const Profile_t& p, float t, float* pos, float* vel) {
+        if (t <= 0.0f) {
+            *pos = 0.0f;
+            *vel = p.v_start;
+        } else if (t < p.t_accel) {
+            *pos = p.v_start * t + 0.5f * p.accel * t * t;
+            *vel = p.v_start + p.accel * t;
+        } else if (t < p.t_accel + p.t_cruise) {
+            *pos = 0.5f * (p.v_start + p.v_cruise) * p.t_accel + p.v_cruise * (t - p.t_accel);
+            *vel = p.v_cruise;
+        } else if (t < p.duration) {
+            // Deceleration is evaluated backwards from the end, so the move ends exactly at length
+            float td = p.duration - t;
+            *pos = p.length - (p.v_end * td + 0.5f * p.accel * td * td);
+            *vel = p.v_end + p.accel * td;
+        } else {
+            *pos = p.length;
+            *vel = p.v_end;
+        }
+    }
+
+    // Path velocity at the joint between move (starting at from) and the
+    // following move next. The path only keeps moving where both moves lie
+    // on one straight line; the velocity is limited to both feed rates and to
+    // what next can still stop from.
+    static float junction_velocity(const std::array<float, 2>& from, const Command_t& move,
+                                   const Command_t& next, float accel) {
+        float ax = move.target[0] - from[0], ay = move.target[1] - from[1];
+        float bx = next.target[0] - move.target[0], by = next.target[1] - move.target[1];
+        float la = std::sqrt(ax * ax + ay * ay);
+        float lb = std::sqrt(bx * bx + by * by);
+        if (!(la > 0.0f) || !(lb > 0.0f)) {
+            return 0.0f;
+        }
+        float cos_angle = (ax * bx + ay * by) / (la * lb);
+        if (cos_angle < COLLINEAR_COS) {
+            return 0.0f;
+        }
+        return std::min({move.value, next.value, std::sqrt(2.0f * accel * lb)});
+    }
+
+    // Called from the communication thread. Queues either all of the
+    // commands or, if there is not enough room, none of them and returns false.
+    bool push(const Command_t* commands, size_t count);
+    bool busy() const { return active_ || head_ != tail_; }
+    void clear();
+
+    // Called from the control loop
+    void update();
+
+    GCodeState_t gcode_;  // modal state after the last accepted line
+
+    std::array<float, 2> get_setpoint();   // current joint space position setpoint
+
+   private:
+    bool start_next();
+    bool start(const Command_t& command);
+    bool step();
+    void write_setpoint(const std::array<float, 2>& pos, const std::array<float, 2>& vel);
+
+    std::array<Command_t, QUEUE_SIZE> queue_;
+    volatile size_t head_ = 0;  // written by push()
+    volatile size_t tail_ = 0;  // written by update()
+
+    bool active_ = false;
+    Command_t command_;
+    bool state_requested_ = false;
+    float t_ = 0.0f;                        // [s] time since the command was started
+    std::array<float, 2> start_pos_ = {};   // [unit]
+    std::array<float, 2> direction_ = {};   // unit vector of the move
+    Profile_t profile_;                     // path position along direction_
+    float path_vel_ = 0.0f;                 // [unit/s] velocity the next move starts with, non-zero only at a junction
+};
+
+#endif // __MOTION_QUEUE_HPP
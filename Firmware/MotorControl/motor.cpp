@@ -3,6 +3,7 @@
 #include "axis.hpp"
 #include "low_level.h"
 #include "odrive_main.h"
+#include "overmodulation.hpp"
 
 #include <algorithm>
 
@@ -26,10 +27,13 @@ struct ResistanceMeasurementControlLaw : AlphaBetaFrameController {
             std::optional<float2D> Ialpha_beta,
             uint32_t input_timestamp) final {
 
+        time_ += current_meas_period;
+
         if (Ialpha_beta.has_value()) {
             actual_current_ = Ialpha_beta->first;
             test_voltage_ += (kI * current_meas_period) * (target_current_ - actual_current_);
             I_beta_ += (kIBetaFilt * current_meas_period) * (Ialpha_beta->second - I_beta_);
+            I_error_ += (kIBetaFilt * current_meas_period) * ((target_current_ - actual_current_) - I_error_);
         } else {
             actual_current_ = 0.0f;
             test_voltage_ = 0.0f;
@@ -69,13 +73,28 @@ struct ResistanceMeasurementControlLaw : AlphaBetaFrameController {
         return I_beta_;
     }
 
+    // The relative current tracking error is the relative error of
+    // get_resistance() (test_voltage_ / target_current_ vs. test_voltage_ /
+    // actual_current_), so the measurement is done once it is within the
+    // tolerance.
+    bool is_done() {
+        bool converged = (tolerance_ > 0.0f) && (time_ >= kMinTime)
+                      && (std::abs(I_error_) <= tolerance_ * std::abs(target_current_));
+        return converged || (time_ >= kMaxTime);
+    }
+
     const float kI = 1.0f; // [(V/s)/A]
     const float kIBetaFilt = 80.0f;
+    const float kMinTime = 0.1f; // [s]
+    const float kMaxTime = 3.0f; // [s]
+    float tolerance_ = 0.0f; // relative, 0 to always run for kMaxTime
     float max_voltage_ = 0.0f;
     float actual_current_ = 0.0f;
     float target_current_ = 0.0f;
     float test_voltage_ = 0.0f;
     float I_beta_ = 0.0f; // [A] low pass filtered Ibeta response
+    float I_error_ = 0.0f; // [A] low pass filtered current tracking error
+    float time_ = 0.0f; // [s]
     std::optional<float> test_mod_ = NAN;
 };
 
@@ -100,11 +119,19 @@ struct InductanceMeasurementControlLaw : AlphaBetaFrameController {
             return {Motor::ERROR_UNKNOWN_CURRENT_MEASUREMENT};
         }
 
-        float Ialpha = Ialpha_beta->first;
+        // Current along the test voltage direction
+        float Ialpha = Ialpha_beta->first * direction_.first + Ialpha_beta->second * direction_.second;
 
         if (attached_) {
             float sign = test_voltage_ >= 0.0f ? 1.0f : -1.0f;
-            deltaI_ += -sign * (Ialpha - last_Ialpha_);
+            float step = -sign * (Ialpha - last_Ialpha_);
+            deltaI_ += step;
+
+            // Running variance of the current steps (Welford)
+            n_steps_++;
+            float delta = step - step_mean_;
+            step_mean_ += delta / (float)n_steps_;
+            step_m2_ += delta * (step - step_mean_);
         } else {
             start_timestamp_ = input_timestamp;
             attached_ = true;
@@ -122,7 +149,7 @@ struct InductanceMeasurementControlLaw : AlphaBetaFrameController {
     {
         test_voltage_ *= -1.0f;
         float vfactor = 1.0f / ((2.0f / 3.0f) * vbus_voltage);
-        *mod_alpha_beta = {test_voltage_ * vfactor, 0.0f};
+        *mod_alpha_beta = {test_voltage_ * vfactor * direction_.first, test_voltage_ * vfactor * direction_.second};
         *ibus = 0.0f;
         return Motor::ERROR_NONE;
     }
@@ -137,8 +164,25 @@ struct InductanceMeasurementControlLaw : AlphaBetaFrameController {
         return std::abs(test_voltage_) / (deltaI_ / dt);
     }
 
+    // The inductance is inversely proportional to the mean current step, so
+    // the measurement is done once the standard error of the mean step is
+    // within the relative tolerance.
+    bool is_done() {
+        float dt = (float)(last_input_timestamp_ - start_timestamp_) / (float)TIM_1_8_CLOCK_HZ;
+        bool converged = false;
+        if (tolerance_ > 0.0f && dt >= kMinTime && n_steps_ >= 2) {
+            float std_error = std::sqrt(step_m2_ / (float)((n_steps_ - 1) * n_steps_));
+            converged = std_error <= tolerance_ * std::abs(step_mean_);
+        }
+        return converged || (attached_ && dt >= kMaxTime);
+    }
+
     // Config
+    const float kMinTime = 0.1f; // [s]
+    const float kMaxTime = 1.25f; // [s]
     float test_voltage_ = 0.0f;
+    float2D direction_ = {1.0f, 0.0f}; // unit vector in the alpha-beta frame
+    float tolerance_ = 0.0f; // relative, 0 to always run for kMaxTime
 
     // State
     bool attached_ = false;
@@ -149,6 +193,9 @@ struct InductanceMeasurementControlLaw : AlphaBetaFrameController {
     float last_Ialpha_ = NAN;
     uint32_t last_input_timestamp_ = 0;
     float deltaI_ = 0.0f;
+    uint32_t n_steps_ = 0;
+    float step_mean_ = 0.0f; // [A]
+    float step_m2_ = 0.0f; // [A^2]
 };
 
 
@@ -206,6 +253,7 @@ bool Motor::arm(PhaseControlLaw<3>* control_law) {
         // Reset controller states, integrators, setpoints, etc.
         axis_->controller_.reset();
         axis_->acim_estimator_.rotor_flux_ = 0.0f;
+        field_weakening_id_ = 0.0f;
         if (control_law_) {
             control_law_->reset();
         }
@@ -330,15 +378,62 @@ void Motor::update_current_controller_gains() {
 
     /*根据电机 phase_inductance 和 phase_resistance 和电流控制带宽 current_control_bandwidth 
     计算电流环的 P 增益 和 I 增益。这是基于模型的控制器调参（Model-Based Tuning），确保电流环的动态响应最优。*/
-    float p_gain = config_.current_control_bandwidth * config_.phase_inductance;
-    float plant_pole = config_.phase_resistance / config_.phase_inductance;
+    auto [L_d, L_q] = get_inductance_dq();
+    float p_gain = config_.current_control_bandwidth * L_d;
+    float plant_pole = config_.phase_resistance / L_d;
     current_control_.pi_gains_ = {p_gain, plant_pole * p_gain};
+    /*凸极电机 Lq != Ld，q 轴比例增益按 Lq/Ld 缩放，使两轴电流环带宽一致（积分增益 R*带宽 两轴相同）*/
+    current_control_.p_gain_q_scale_ = (L_d > 0.0f) ? L_q / L_d : 1.0f;
+
+    float max_modulation = config_.enable_overmodulation
+                         ? overmodulation::SIX_STEP_LIMIT / overmodulation::LINEAR_LIMIT
+                         : 1.0f;
+    current_control_.max_modulation_ = std::clamp(config_.max_modulation, 0.0f, max_modulation);
+    current_control_.enable_overmodulation_ = config_.enable_overmodulation;
+    current_control_.enable_complex_vector_ = config_.enable_complex_vector_current_control;
+
+    /*无差拍电流控制的电机模型参数，磁链由力矩常数得到 psi = Kt / (1.5 * p)*/
+    current_control_.deadbeat_.R_ = config_.phase_resistance;
+    current_control_.deadbeat_.Ld_ = L_d;
+    current_control_.deadbeat_.Lq_ = L_q;
+    current_control_.deadbeat_.flux_linkage_ = (config_.motor_type == MOTOR_TYPE_HIGH_CURRENT && config_.pole_pairs > 0)
+                                             ? config_.torque_constant / (1.5f * (float)config_.pole_pairs) : 0.0f;
+    current_control_.deadbeat_.gain_ = std::clamp(config_.deadbeat_gain, 0.0f, 1.0f);
+    current_control_.deadbeat_.Ts_ = current_meas_period;
+    current_control_.enable_deadbeat_ = config_.enable_deadbeat_current_control && current_control_.deadbeat_.is_valid();
+
+    // The PWM period is two timer periods (center aligned)
+    current_control_.enable_dead_time_comp_ = config_.enable_dead_time_comp && (config_.dead_time_comp_current_band > 0.0f);
+    current_control_.dead_time_comp_ = config_.dead_time_comp_time * (float)TIM_1_8_CLOCK_HZ / (float)(2 * TIM_1_8_PERIOD_CLOCKS);
+    current_control_.switch_drop_comp_ = config_.dead_time_comp_voltage;
+    current_control_.dead_time_comp_band_ = config_.dead_time_comp_current_band;
+}
+
+// @brief Regenerates the MTPA lookup table from the motor parameters.
+// This should be invoked whenever one of these values changes.
+void Motor::update_mtpa_table() {
+    if (config_.enable_mtpa) {
+        mtpa_table_.generate(config_.torque_constant, config_.phase_inductance_d, config_.phase_inductance_q,
+                             (float)config_.pole_pairs, config_.current_lim);
+    } else {
+        mtpa_table_ = {};
+    }
+}
+
+// @brief Returns {Ld, Lq}, falling back to phase_inductance for motors
+// without separate d/q values.
+float2D Motor::get_inductance_dq() {
+    if (config_.phase_inductance_d > 0.0f && config_.phase_inductance_q > 0.0f) {
+        return {config_.phase_inductance_d, config_.phase_inductance_q};
+    }
+    return {config_.phase_inductance, config_.phase_inductance};
 }
 
 bool Motor::apply_config() {
     config_.parent = this;
     is_calibrated_ = config_.pre_calibrated;
     update_current_controller_gains();
+    update_mtpa_table();
     return true;
 }
 
@@ -506,14 +601,14 @@ bool Motor::measure_phase_resistance(float test_current, float max_voltage) {
     ResistanceMeasurementControlLaw control_law;
     control_law.target_current_ = test_current;
     control_law.max_voltage_ = max_voltage;
+    control_law.tolerance_ = config_.calibration_tolerance;
 
     arm(&control_law);
 
-    for (size_t i = 0; i < 3000; ++i) {
-        if (!((axis_->requested_state_ == Axis::AXIS_STATE_UNDEFINED) && axis_->motor_.is_armed_)) {
-            break;
-        }
-        osDelay(1);
+    /*测量值收敛到容差以内（或达到最长时间）即结束，不再固定等待 3 秒*/
+    while ((axis_->requested_state_ == Axis::AXIS_STATE_UNDEFINED) && axis_->motor_.is_armed_
+           && !control_law.is_done()) {
+        axis_->wait_for_control_iteration();
     }
 
     bool success = is_armed_;
@@ -545,37 +640,60 @@ bool Motor::measure_phase_resistance(float test_current, float max_voltage) {
 /**
  * 测量电机相电感（phase inductance）函数，通过施加交变电压并测量电流变化率来计算电感值。
  * 动态测量电机相电感（单位：H），用于电机参数自动辨识。
- * 输入参数：voltage_low 低电平测试电压（如-5V）voltage_high 高电平测试电压（如+5V）。
- * 输出：true 测量成功，结果存入 config_.phase_inductance，false 测量失败（错误码记录在 axis_->error_）
+ * 输入参数：test_voltage 交变测试电压幅值（如 ±2V）。
+ * 输出：true 测量成功，结果存入 config_.phase_inductance_d/_q 和 config_.phase_inductance（两者平均），
+ * false 测量失败（错误码记录在 axis_->error_）
+ *
+ * Must run right after measure_phase_resistance(): its DC current along alpha
+ * leaves the rotor d axis aligned with alpha (locked rotor), so the response
+ * along alpha is Ld and the response along beta is Lq. The test voltage has
+ * zero mean and does not move the rotor. Induction motors have no saliency,
+ * only the alpha response is measured and used for both axes.
  */
 bool Motor::measure_phase_inductance(float test_voltage) {
-    InductanceMeasurementControlLaw control_law;
-    control_law.test_voltage_ = test_voltage;
+    const float2D directions[2] = {{1.0f, 0.0f}, {0.0f, 1.0f}};
+    size_t n_directions = (config_.motor_type == MOTOR_TYPE_ACIM) ? 1 : 2;
+    float inductance[2];
+
+    bool success = true;
+    for (size_t k = 0; k < n_directions; ++k) {
+        InductanceMeasurementControlLaw control_law;
+        control_law.test_voltage_ = test_voltage;
+        control_law.direction_ = directions[k];
+        control_law.tolerance_ = config_.calibration_tolerance;
+
+        arm(&control_law);
+
+        while ((axis_->requested_state_ == Axis::AXIS_STATE_UNDEFINED) && axis_->motor_.is_armed_
+               && !control_law.is_done()) {
+            axis_->wait_for_control_iteration();
+        }
 
-    arm(&control_law);
+        success = success && is_armed_;
 
-    for (size_t i = 0; i < 1250; ++i) {
-        if (!((axis_->requested_state_ == Axis::AXIS_STATE_UNDEFINED) && axis_->motor_.is_armed_)) {
-            break;
-        }
-        osDelay(1);
-    }
+        //// De-energize motor
+        //if (!enqueue_voltage_timings(motor, 0.0f, 0.0f))
+        //    return false; // error set inside enqueue_voltage_timings
 
-    bool success = is_armed_;
+        disarm();
 
-    //// De-energize motor
-    //if (!enqueue_voltage_timings(motor, 0.0f, 0.0f))
-    //    return false; // error set inside enqueue_voltage_timings
+        inductance[k] = control_law.get_inductance();
 
-    disarm();
+        // TODO arbitrary values set for now
+        if (!(inductance[k] >= 2e-6f && inductance[k] <= 4000e-6f)) {
+            /*问题可能因为电流采样电阻值定义错误，电源供电不稳定，硬件电路连接异常导致采集不到有效的电流导致电机相电感测量无效*/
+            error_ |= ERROR_PHASE_INDUCTANCE_OUT_OF_RANGE;
+            success = false;
+        }
+        if (!success) {
+            break;
+        }
+    }
 
-    config_.phase_inductance = control_law.get_inductance();
-    
-    // TODO arbitrary values set for now
-    if (!(config_.phase_inductance >= 2e-6f && config_.phase_inductance <= 4000e-6f)) {
-        /*问题可能因为电流采样电阻值定义错误，电源供电不稳定，硬件电路连接异常导致采集不到有效的电流导致电机相电感测量无效*/
-        error_ |= ERROR_PHASE_INDUCTANCE_OUT_OF_RANGE;
-        success = false;
+    if (success) {
+        config_.phase_inductance_d = inductance[0];
+        config_.phase_inductance_q = inductance[n_directions - 1];
+        config_.phase_inductance = 0.5f * (config_.phase_inductance_d + config_.phase_inductance_q);
     }
 
     return success;
@@ -602,6 +720,7 @@ bool Motor::run_calibration() {
     }
 
     update_current_controller_gains();
+    update_mtpa_table();
     
     is_calibrated_ = true;
     return true;
@@ -626,6 +745,9 @@ void Motor::update(uint32_t timestamp) {
     // Load effective current limit
     float ilim = axis_->motor_.effective_current_lim_;
 
+    bool mtpa = (axis_->motor_.config_.motor_type == Motor::MOTOR_TYPE_HIGH_CURRENT)
+             && config_.enable_mtpa && mtpa_table_.is_valid();
+
     /*Autoflux 跟踪的是上一次的 Iq (此时的 Iq 还没有更新，需要到下面才会进行更新), 以确保我们追踪的是一个可行的电流。*/
     // Autoflux tracks old Iq (that may be 2-norm clamped last cycle) to make sure we are chasing a feasable current.
     if ((axis_->motor_.config_.motor_type == Motor::MOTOR_TYPE_ACIM) && config_.acim_autoflux_enable) {
@@ -634,6 +756,22 @@ void Motor::update(uint32_t timestamp) {
         id += gain * (abs_iq - id) * current_meas_period;
         id = std::clamp(id, config_.acim_autoflux_min_Id, 0.9f * ilim); // 10% space reserved for Iq
     } else {
+        /*弱磁控制：电流环输出电压接近调制上限时，积分出负的 Id 以削弱磁场，提高最高转速*/
+        if ((axis_->motor_.config_.motor_type == Motor::MOTOR_TYPE_HIGH_CURRENT) && config_.enable_field_weakening) {
+            // The modulation is from the last FOC iteration and saturates at max_modulation_
+            float mod = std::sqrt(SQ(current_control_.mod_d_) + SQ(current_control_.mod_q_));
+            float mod_lim = current_control_.max_modulation_ * sqrt3_by_2;
+            float excess = mod / mod_lim - config_.field_weakening_modulation;
+            float id_min = -std::min(config_.field_weakening_max_current, ilim * 0.99f);
+            field_weakening_id_ -= config_.field_weakening_gain * excess * current_meas_period;
+            field_weakening_id_ = std::clamp(field_weakening_id_, id_min, 0.0f);
+            id = field_weakening_id_;
+        } else {
+            field_weakening_id_ = 0.0f;
+            if (mtpa) {
+                id = 0.0f; // the MTPA Id is added again below
+            }
+        }
         id = std::clamp(id, -ilim * 0.99f, ilim * 0.99f); // 1% space reserved for Iq to avoid numerical issues
     }
 
@@ -641,6 +779,11 @@ void Motor::update(uint32_t timestamp) {
     // Convert requested torque to current
     if (axis_->motor_.config_.motor_type == Motor::MOTOR_TYPE_ACIM) {
         iq = torque / (axis_->motor_.config_.torque_constant * std::max(axis_->acim_estimator_.rotor_flux_, config_.acim_gain_min_flux));
+    } else if (mtpa) {
+        /*MTPA：凸极电机利用磁阻转矩，查表得到单位电流转矩最大的 Id，弱磁的 Id 在此基础上叠加*/
+        float id_mtpa = mtpa_table_.get_current(torque).first;
+        id = std::clamp(id + id_mtpa, -ilim * 0.99f, ilim * 0.99f);
+        iq = mtpa_table_.get_iq(torque, id);
     } else {
         iq = torque / axis_->motor_.config_.torque_constant;
     }
@@ -694,8 +837,9 @@ void Motor::update(uint32_t timestamp) {
             return;
         }
 
-        vd -= *phase_vel * config_.phase_inductance * iq;
-        vq += *phase_vel * config_.phase_inductance * id;
+        auto [L_d, L_q] = get_inductance_dq();
+        vd -= *phase_vel * L_q * iq;
+        vq += *phase_vel * L_d * id;
         vd += config_.phase_resistance * id;
         vq += config_.phase_resistance * iq;
     }
@@ -872,3 +1016,17 @@ void Motor::pwm_update_cb(uint32_t output_timestamp) {
 
     update_brake_current();
 }
+
+/**
+ * @brief Second PWM update between two current measurements, used when
+ * config.enable_double_pwm_update is set.
+ *
+ * Only the FOC supports this: it reuses mod_d and mod_q and only recomputes
+ * the inverse Park transform and SVM. The measurement control laws expect one
+ * output per measurement, so for them the previous timings are kept.
+ */
+void Motor::pwm_mid_update_cb(uint32_t output_timestamp) {
+    if (control_law_ == &current_control_) {
+        pwm_update_cb(output_timestamp);
+    }
+}
@@ -7,6 +7,7 @@ class Motor;
 #include <board.h>
 #include <autogen/interfaces.hpp>
 #include "foc.hpp"
+#include "mtpa.hpp"
 
 class Motor : public ODriveIntf::MotorIntf {
 public:
@@ -19,7 +20,8 @@ public:
         int32_t pole_pairs = 7;
         float calibration_current = 10.0f;    // [A]
         float resistance_calib_max_voltage = 2.0f; // [V] - You may need to increase this if this voltage isn't sufficient to drive calibration_current through the motor.
-        float phase_inductance = 0.0f;        // to be set by measure_phase_inductance
+        float calibration_tolerance = 0.002f; // Relative error at which the resistance and inductance measurements finish early. 0 to always run for the full time.
+        float phase_inductance = 0.0f;        // to be set by measure_phase_inductance, mean of phase_inductance_d and _q
         float phase_resistance = 0.0f;        // to be set by measure_phase_resistance
         float torque_constant = 0.04f;         // [Nm/A] for PM motors, [Nm/A^2] for induction motors. Equal to 8.27/Kv of the motor
         MotorType motor_type = MOTOR_TYPE_HIGH_CURRENT;
@@ -49,15 +51,75 @@ public:
 
         float dc_calib_tau = 0.2f;
 
+        // Current controller output limit as a fraction of the linear SVM range (sqrt(3)/2 * 2/3 * vbus).
+        // Values above 1.0 need enable_overmodulation, up to 1.1027 (six-step).
+        float max_modulation = 0.80f;
+        bool enable_overmodulation = false;
+
+        // Complex vector current regulator: compensates the w*L cross-coupling between the d and q
+        // axes inside the current controller, which keeps the bandwidth at high electrical speed.
+        bool enable_complex_vector_current_control = false;
+
+        // Deadbeat predictive current control instead of the PI current controller: the voltage that
+        // brings the current to the setpoint within one period is computed from the motor model
+        // (phase_resistance, phase_inductance_d/_q, torque_constant). deadbeat_gain < 1 corrects only that
+        // fraction of the error per period, for robustness against inductance errors.
+        bool enable_deadbeat_current_control = false;
+        float deadbeat_gain = 1.0f;
+
+        // Dead-time and switch voltage drop compensation of the PWM timings, based on the sign of
+        // each phase current. dead_time_comp_time includes the gate driver switching delays.
+        bool enable_dead_time_comp = false;
+        float dead_time_comp_time = (float)TIM_1_8_DEADTIME_CLOCKS / (float)TIM_1_8_CLOCK_HZ; // [s]
+        float dead_time_comp_voltage = 0.0f;        // [V] FET/diode voltage drop
+        float dead_time_comp_current_band = 0.5f;   // [A] linear transition around zero current
+
+        // Field weakening (MOTOR_TYPE_HIGH_CURRENT): negative Id is integrated up while the current
+        // controller output is above field_weakening_modulation (fraction of max_modulation)
+        bool enable_field_weakening = false;
+        float field_weakening_modulation = 0.95f;
+        float field_weakening_gain = 2000.0f;       // [A/s] per unit of modulation above the threshold
+        float field_weakening_max_current = 10.0f;  // [A] largest |Id|, also limited by the current limit
+
+        // Maximum torque per amp (MOTOR_TYPE_HIGH_CURRENT): for salient (IPM) motors, split the current
+        // between Id and Iq to use the reluctance torque. Needs both inductances, the table covers
+        // torques up to current_lim and is regenerated by apply_config() or the setters below.
+        bool enable_mtpa = false;
+        // Set by measure_phase_inductance. If both are set they replace phase_inductance in the
+        // current controller gains and the R_wL feedforward. set_phase_inductance() clears them.
+        float phase_inductance_d = 0.0f;      // [H]
+        float phase_inductance_q = 0.0f;      // [H]
+
         // custom property setters
         Motor* parent = nullptr;
         void set_pre_calibrated(bool value) {
             pre_calibrated = value;
             parent->is_calibrated_ = parent->is_calibrated_ || parent->config_.pre_calibrated;
         }
-        void set_phase_inductance(float value) { phase_inductance = value; parent->update_current_controller_gains(); }
+        void set_phase_inductance(float value) {
+            // A single inductance set by the user overrides the measured d/q values
+            phase_inductance = value;
+            phase_inductance_d = 0.0f;
+            phase_inductance_q = 0.0f;
+            parent->update_current_controller_gains();
+            parent->update_mtpa_table();
+        }
         void set_phase_resistance(float value) { phase_resistance = value; parent->update_current_controller_gains(); }
         void set_current_control_bandwidth(float value) { current_control_bandwidth = value; parent->update_current_controller_gains(); }
+        void set_max_modulation(float value) { max_modulation = value; parent->update_current_controller_gains(); }
+        void set_enable_overmodulation(bool value) { enable_overmodulation = value; parent->update_current_controller_gains(); }
+        void set_enable_complex_vector_current_control(bool value) { enable_complex_vector_current_control = value; parent->update_current_controller_gains(); }
+        void set_enable_deadbeat_current_control(bool value) { enable_deadbeat_current_control = value; parent->update_current_controller_gains(); }
+        void set_deadbeat_gain(float value) { deadbeat_gain = value; parent->update_current_controller_gains(); }
+        void set_enable_dead_time_comp(bool value) { enable_dead_time_comp = value; parent->update_current_controller_gains(); }
+        void set_dead_time_comp_time(float value) { dead_time_comp_time = value; parent->update_current_controller_gains(); }
+        void set_dead_time_comp_voltage(float value) { dead_time_comp_voltage = value; parent->update_current_controller_gains(); }
+        void set_dead_time_comp_current_band(float value) { dead_time_comp_current_band = value; parent->update_current_controller_gains(); }
+        void set_pole_pairs(int32_t value) { pole_pairs = value; parent->update_current_controller_gains(); parent->update_mtpa_table(); }
+        void set_torque_constant(float value) { torque_constant = value; parent->update_current_controller_gains(); parent->update_mtpa_table(); }
+        void set_enable_mtpa(bool value) { enable_mtpa = value; parent->update_mtpa_table(); }
+        void set_phase_inductance_d(float value) { phase_inductance_d = value; parent->update_current_controller_gains(); parent->update_mtpa_table(); }
+        void set_phase_inductance_q(float value) { phase_inductance_q = value; parent->update_current_controller_gains(); parent->update_mtpa_table(); }
     };
 
     Motor(TIM_HandleTypeDef* timer,
@@ -75,6 +137,8 @@ public:
     bool setup();
 
     void update_current_controller_gains();
+    void update_mtpa_table();
+    float2D get_inductance_dq();
     void disarm_with_error(Error error);
     bool do_checks(uint32_t timestamp);
     float effective_current_lim();
@@ -89,6 +153,7 @@ public:
     void current_meas_cb(uint32_t timestamp, std::optional<Iph_ABC_t> current);
     void dc_calib_cb(uint32_t timestamp, std::optional<Iph_ABC_t> current);
     void pwm_update_cb(uint32_t output_timestamp);
+    void pwm_mid_update_cb(uint32_t output_timestamp);
 
     // hardware config
     TIM_HandleTypeDef* const timer_;
@@ -122,6 +187,8 @@ public:
     float phase_current_rev_gain_ = 0.0f; // Reverse gain for ADC to Amps (to be set by DRV8301_setup)
     FieldOrientedController current_control_;
     float effective_current_lim_ = 10.0f; // [A]
+    float field_weakening_id_ = 0.0f; // [A] Id commanded by the field weakening regulator
+    MtpaTable mtpa_table_;
     float max_allowed_current_ = 0.0f; // [A] set in setup()
     float max_dc_calib_ = 0.0f; // [A] set in setup()
 
@@ -0,0 +1,94 @@
+#ifndef __MTPA_HPP
+#define __MTPA_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+/**
+ * @brief Maximum torque per amp current split for salient (IPM) motors.
+ *
+ * With Ld != Lq the reluctance torque 1.5 * p * (Ld - Lq) * Id * Iq adds to
+ * the magnet torque, so for a given current magnitude Is the torque is
+ * highest at a negative Id (for Lq > Ld):
+ *   Id = (psi - sqrt(psi^2 + 8 * (Lq - Ld)^2 * Is^2)) / (4 * (Lq - Ld))
+ *
+ * The flux linkage is derived from the torque constant, psi = Kt / (1.5 * p),
+ * which is the same relation used by the bEMF feedforward.
+ * generate() tabulates torque and Id over Is = 0 ... max_current, so that the
+ * control loop only needs a binary search and a linear interpolation.
+ */
+class MtpaTable {
+   public:
+    static constexpr size_t TABLE_SIZE = 32;
+
+    bool generate(float torque_constant, float phase_inductance_d, float phase_inductance_q,
+                  float pole_pairs, float max_current) {
+        valid_ = false;
+        if (!(torque_constant > 0.0f) || !(phase_inductance_d > 0.0f) || !(phase_inductance_q > 0.0f)
+            || !(pole_pairs > 0.0f) || !(max_current > 0.0f)) {
+            return false;
+        }
+        float dL = phase_inductance_q - phase_inductance_d;
+        float psi = torque_constant / (1.5f * pole_pairs);
+        if (!(std::abs(dL) * max_current > 1e-4f * psi)) {
+            return false; // not salient enough to matter, Id = 0 is optimal
+        }
+
+        torque_constant_ = torque_constant;
+        reluctance_gain_ = -1.5f * pole_pairs * dL; // 1.5 * p * (Ld - Lq)
+        for (size_t i = 0; i < TABLE_SIZE; ++i) {
+            float is = max_current * (float)i / (float)(TABLE_SIZE - 1);
+            float id = (psi - std::sqrt(psi * psi + 8.0f * dL * dL * is * is)) / (4.0f * dL);
+            float iq_sqr = is * is - id * id;
+            float iq = iq_sqr > 0.0f ? std::sqrt(iq_sqr) : 0.0f;
+            id_table_[i] = id;
+            torque_table_[i] = iq * (torque_constant_ + reluctance_gain_ * id);
+        }
+        valid_ = true;
+        return true;
+    }
+
+    bool is_valid() const { return valid_; }
+
+    // Returns {Id, Iq} for the given torque [Nm]. Above the table range Id is
+    // held at the last entry and Iq carries the rest.
+    std::pair<float, float> get_current(float torque) const {
+        float abs_torque = std::abs(torque);
+
+        float id;
+        if (abs_torque >= torque_table_[TABLE_SIZE - 1]) {
+            id = id_table_[TABLE_SIZE - 1];
+        } else {
+            size_t lo = 0;
+            size_t hi = TABLE_SIZE - 1;
+            while (hi - lo > 1) {
+                size_t mid = (lo + hi) / 2;
+                if (torque_table_[mid] <= abs_torque) {
+                    lo = mid;
+                } else {
+                    hi = mid;
+                }
+            }
+            float fract = (abs_torque - torque_table_[lo]) / (torque_table_[hi] - torque_table_[lo]);
+            id = id_table_[lo] + fract * (id_table_[hi] - id_table_[lo]);
+        }
+
+        return {id, get_iq(torque, id)};
+    }
+
+    // Iq that produces exactly the requested torque at the given Id, e.g.
+    // after field weakening has added to the MTPA Id
+    float get_iq(float torque, float id) const {
+        return torque / (torque_constant_ + reluctance_gain_ * id);
+    }
+
+   private:
+    bool valid_ = false;
+    float torque_constant_ = 0.0f;
+    float reluctance_gain_ = 0.0f;    // [Nm/A^2]
+    float torque_table_[TABLE_SIZE] = {};  // [Nm] along the MTPA trajectory
+    float id_table_[TABLE_SIZE] = {};      // [A]
+};
+
+#endif // __MTPA_HPP
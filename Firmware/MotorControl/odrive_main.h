@@ -9,6 +9,8 @@
 #include <communication/interface_i2c.h>
 #include <communication/interface_uart.h>
 #include <task_timer.hpp>
+#include <kinematics.hpp>
+#include <motion_queue.hpp>
 extern "C" {
 #endif
 
@@ -111,8 +113,11 @@ struct BoardConfig_t {
     float dc_max_negative_current = -0.01f; // 电源可以吸收的反电动势电流，Max current [A] the power supply can sink. 
                                             // You most likely want a non-positive value here. Set to -INFINITY to disable.
     uint32_t error_gpio_pin = DEFAULT_ERROR_PIN;
+    bool enable_double_pwm_update = false; // update the FOC PWM output twice per current measurement, reusing mod_d/mod_q
     PWMMapping_t pwm_mappings[4];
     PWMMapping_t analog_mappings[GPIO_COUNT];
+    Kinematics::Config_t kinematics;    // joint space <-> motor space transform of axis0 and axis1
+    MotionQueue::Config_t motion_queue; // G-code motion limits
 };
 
 struct TaskTimes {
@@ -191,6 +196,14 @@ public:
     void sampling_cb();
     void control_loop_cb(uint32_t timestamp);
 
+    // Time-synchronized trajectory move of all axes
+    bool move_to_pos_coordinated(std::array<float, AXIS_COUNT> goal_points);
+    void update_coordinated_move();
+
+    // Joint space setpoints and estimates of a coupled two-axis mechanism
+    bool set_kinematics_input(std::array<float, 2> pos, std::array<float, 2> vel, std::array<float, 2> force);
+    void update_kinematics();
+
     Axis& get_axis(int num) { return axes[num]; }
 
     uint32_t get_interrupt_status(int32_t irqn);
@@ -241,9 +254,26 @@ public:
 
     uint32_t last_update_timestamp_ = 0;
     uint32_t n_evt_sampling_ = 0;
+    uint32_t sampling_time_us_ = 0; // micros() at the last encoder sample, reference for endstop edge captures
     uint32_t n_evt_control_loop_ = 0;
     bool task_timers_armed_ = false;
     TaskTimes task_times_;
+
+    // Coordinated move state. The plan is made in control_loop_cb() so that
+    // all axes start their trajectories on the same tick.
+    std::array<float, AXIS_COUNT> coordinated_goal_points_ = {};
+    bool coordinated_move_pending_ = false;
+
+    // Kinematic transform state, see update_kinematics()
+    Kinematics kinematics_;
+    std::array<float, 2> kinematics_input_pos_ = {};    // [joint unit]
+    std::array<float, 2> kinematics_input_vel_ = {};    // [joint unit/s]
+    std::array<float, 2> kinematics_input_force_ = {};  // [Nm or N, depending on joint unit]
+    bool kinematics_input_pending_ = false;
+    std::array<float, 2> kinematics_pos_estimate_ = {}; // [joint unit]
+    std::array<float, 2> kinematics_vel_estimate_ = {}; // [joint unit/s]
+
+    MotionQueue motion_queue_;
     const bool otp_valid_ = ((uint8_t*)FLASH_OTP_BASE)[0] != 0xff;
 };
 
@@ -0,0 +1,101 @@
+#ifndef __OVERMODULATION_HPP
+#define __OVERMODULATION_HPP
+
+#include <cmath>
+#include <cstddef>
+#include "fast_sincos.hpp"
+
+/**
+ * @brief Maps a modulation vector beyond the linear SVM range onto the
+ * voltage hexagon, such that the fundamental of the output over an electrical
+ * revolution still equals the magnitude of the input (Bolognani/Zigliotto).
+ *
+ * Magnitudes are in the units of SVM(), where the hexagon vertices are at 1.
+ *  - up to LINEAR_LIMIT: unchanged, the circle fits into the hexagon
+ *  - mode I, up to MODE_I_LIMIT: the vector is stretched and clipped to the
+ *    hexagon edge
+ *  - mode II, up to SIX_STEP_LIMIT: the vector moves along the hexagon edges
+ *    and is held at the vertices for part of each sextant
+ *  - beyond: six-step operation, the nearest vertex
+ */
+namespace overmodulation {
+
+constexpr float LINEAR_LIMIT = 0.866025404f;   // sqrt(3)/2
+constexpr float MODE_I_LIMIT = 0.908545049f;   // fundamental of the hexagon at uniform angle
+constexpr float SIX_STEP_LIMIT = 0.954929659f; // 3/pi
+
+constexpr size_t TABLE_SIZE = 17;
+
+// Mode I: stretched magnitude over |v| = LINEAR_LIMIT ... MODE_I_LIMIT
+constexpr float stretch_table[TABLE_SIZE] = {
+    0.866025f, 0.868996f, 0.872300f, 0.875887f, 0.879756f, 0.883921f, 0.888408f, 0.893254f, 0.898509f,
+    0.904242f, 0.910551f, 0.917578f, 0.925540f, 0.934808f, 0.946104f, 0.961293f, 1.000000f
+};
+
+// Mode II: hold angle [rad] at each vertex over |v| = MODE_I_LIMIT ... SIX_STEP_LIMIT
+constexpr float hold_angle_table[TABLE_SIZE] = {
+    0.000000f, 0.016854f, 0.034256f, 0.052267f, 0.070960f, 0.090423f, 0.110765f, 0.132124f, 0.154677f,
+    0.178656f, 0.204385f, 0.232326f, 0.263191f, 0.298178f, 0.339624f, 0.393566f, 0.523599f
+};
+
+inline float interpolate(const float (&table)[TABLE_SIZE], float x, float x0, float x1) {
+    float findex = (x - x0) / (x1 - x0) * (float)(TABLE_SIZE - 1);
+    if (!(findex > 0.0f)) {
+        return table[0];
+    } else if (findex >= (float)(TABLE_SIZE - 1)) {
+        return table[TABLE_SIZE - 1];
+    }
+    size_t index = (size_t)findex;
+    float fract = findex - (float)index;
+    return table[index] + fract * (table[index + 1] - table[index]);
+}
+
+// Returns true if the vector was modified
+inline bool apply(float* alpha, float* beta) {
+    constexpr float pi_by_3 = 1.04719755f;
+    constexpr float pi_by_6 = 0.523598776f;
+
+    float m = std::sqrt(*alpha * *alpha + *beta * *beta);
+    if (!(m > LINEAR_LIMIT)) {
+        return false;
+    }
+
+    // Sextant k spans the vertices at k * 60deg and (k + 1) * 60deg, phi is
+    // the angle from the first one
+    float theta = std::atan2(*beta, *alpha);
+    if (theta < 0.0f) {
+        theta += 6.0f * pi_by_3;
+    }
+    int k = (int)(theta * (1.0f / pi_by_3));
+    k = k < 0 ? 0 : (k > 5 ? 5 : k);
+    float phi = theta - (float)k * pi_by_3;
+
+    if (m <= MODE_I_LIMIT) {
+        // The hexagon edge is at LINEAR_LIMIT / cos(phi - 30deg)
+        float r = interpolate(stretch_table, m, LINEAR_LIMIT, MODE_I_LIMIT);
+        float edge_cos = fast_sincos(phi - pi_by_6).cos;
+        float rho = (r * edge_cos > LINEAR_LIMIT) ? LINEAR_LIMIT / edge_cos : r;
+        *alpha *= rho / m;
+        *beta *= rho / m;
+        return true;
+    }
+
+    float hold = interpolate(hold_angle_table, m, MODE_I_LIMIT, SIX_STEP_LIMIT);
+    float phi_out;
+    if (phi <= hold) {
+        phi_out = 0.0f;
+    } else if (phi >= pi_by_3 - hold) {
+        phi_out = pi_by_3;
+    } else {
+        phi_out = (phi - hold) * pi_by_3 / (pi_by_3 - 2.0f * hold);
+    }
+    float rho = LINEAR_LIMIT / fast_sincos(phi_out - pi_by_6).cos;
+    SinCos sc = fast_sincos((float)k * pi_by_3 + phi_out);
+    *alpha = rho * sc.cos;
+    *beta = rho * sc.sin;
+    return true;
+}
+
+} // namespace overmodulation
+
+#endif // __OVERMODULATION_HPP
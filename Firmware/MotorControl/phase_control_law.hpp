@@ -82,7 +82,23 @@ private:
             float (&pwm_timings)[3],
             std::optional<float>* ibus) final;
 
+public:
+    bool enable_overmodulation_ = false; // let SVM() map vectors beyond the linear range onto the hexagon
+
+    // Dead-time and switch voltage drop compensation of the SVM timings, see get_output()
+    bool enable_dead_time_comp_ = false;
+    float dead_time_comp_ = 0.0f;        // [fraction of the PWM period]
+    float switch_drop_comp_ = 0.0f;      // [V]
+    float dead_time_comp_band_ = 0.5f;   // [A] the compensation ramps linearly through zero current
+
 protected:
+    /**
+     * @brief Called from get_output() with the difference between the applied
+     * and the commanded voltage, in the alpha-beta frame, that remains after
+     * dead-time compensation (e.g. because a timing was clamped).
+     */
+    virtual void on_voltage_error(float /*v_alpha*/, float /*v_beta*/) {}
+
     virtual ODriveIntf::MotorIntf::Error on_measurement(
             std::optional<float> vbus_voltage,
             std::optional<float2D> Ialpha_beta,
@@ -92,6 +108,12 @@ protected:
             uint32_t output_timestamp,
             std::optional<float2D>* mod_alpha_beta,
             std::optional<float>* ibus) = 0;
+
+private:
+    void compensate_dead_time(float (&pwm_timings)[3]);
+
+    std::optional<float> vbus_voltage_;
+    std::optional<std::array<float, 3>> currents_;
 };
 
 #endif // __PHASE_CONTROL_LAW_HPP
\ No newline at end of file
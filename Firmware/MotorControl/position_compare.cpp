@@ -0,0 +1,80 @@
+#include <odrive_main.h>
+
+/*位置比较输出：位置估计越过设定位置时输出脉冲（或翻转）GPIO，例如触发相机拍照*/
+
+bool PositionCompare::apply_config() {
+    config_.parent = this;
+    if (config_.gpio_num >= GPIO_COUNT) {
+        config_.enabled = false;
+    }
+    primed_ = false;
+    pulse_remaining_ = 0.0f;
+    tick_count_ = 0;
+    write(false);
+    return true;
+}
+
+void PositionCompare::write(bool active) {
+    output_active_ = active;
+    if (config_.enabled && odrv.config_.gpio_modes[config_.gpio_num] == ODriveIntf::GPIO_MODE_STATUS
+        && config_.gpio_num != odrv.config_.error_gpio_pin) {
+        get_gpio(config_.gpio_num).write(active == config_.is_active_high);
+    }
+}
+
+/**
+ * @brief Checks for crossings and drives the output.
+ *
+ * Must be called from the control loop after the encoders are updated.
+ * The position half a control period ahead is compared against the
+ * configured positions, so that each crossing is output on the tick closest
+ * to when it happens.
+ */
+void PositionCompare::update() {
+    ++tick_count_;
+
+    if (pulse_remaining_ > 0.0f) {
+        pulse_remaining_ -= current_meas_period;
+        if (pulse_remaining_ <= 0.0f) {
+            write(false);
+        }
+    }
+
+    if (!config_.enabled) {
+        primed_ = false;
+        return;
+    }
+
+    std::optional<SplitPosition> pos = axis_->controller_.pos_estimate_linear_split_src_.present();
+    std::optional<float> vel = axis_->controller_.vel_estimate_src_.present();
+    if (!pos.has_value() || !vel.has_value()) {
+        primed_ = false;
+        return;
+    }
+
+    SplitPosition lookahead_pos = *pos + 0.5f * current_meas_period * *vel;
+    if (!primed_) {
+        lookahead_pos_ = lookahead_pos;
+        primed_ = true;
+        return;
+    }
+
+    SplitPosition crossed;
+    size_t count = find_crossing(config_, lookahead_pos_, lookahead_pos, &crossed);
+    if (count > 0) {
+        // Interpolated crossing time within [now - period / 2, now + period / 2]
+        float fraction = (crossed - lookahead_pos_) / (lookahead_pos - lookahead_pos_);
+        last_trigger_tick_ = tick_count_;
+        last_trigger_offset_ = (fraction - 0.5f) * current_meas_period;
+        last_trigger_pos_ = crossed.to_float();
+        trigger_count_ += count;
+
+        if (config_.pulse_width > 0.0f) {
+            write(true);
+            pulse_remaining_ = config_.pulse_width;
+        } else {
+            write(!output_active_);
+        }
+    }
+    lookahead_pos_ = lookahead_pos;
+}
@@ -0,0 +1,119 @@
+#ifndef __POSITION_COMPARE_HPP
+#define __POSITION_COMPARE_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "split_position.hpp"
+
+class Axis;
+
+// Drives a GPIO when the position estimate crosses configured positions, e.g.
+// to trigger a camera. Evaluated in the control loop: a crossing is assigned
+// to the tick closest to the interpolated crossing time, so the output edge is
+// within half a control period of the actual crossing.
+class PositionCompare {
+   public:
+    static constexpr size_t MAX_POSITIONS = 32;
+
+    enum Mode {
+        MODE_LIST = 0,      // trigger at each entry of positions[]
+        MODE_INTERVAL = 1,  // trigger at interval_start + k * interval
+    };
+
+    struct Config_t {
+        bool enabled = false;
+        uint16_t gpio_num = 0;        // must be configured as GPIO_MODE_STATUS (push-pull output)
+        bool is_active_high = true;
+        uint8_t mode = MODE_INTERVAL; // see PositionCompare::Mode
+        float interval_start = 0.0f;  // [turn]
+        float interval = 1.0f;        // [turn]
+        uint32_t num_positions = 0;
+        float positions[MAX_POSITIONS] = {};  // [turn]
+        float pulse_width = 0.001f;   // [s] 0 to toggle the output on every trigger instead
+
+        // custom setters
+        PositionCompare* parent = nullptr;
+        void set_enabled(bool value) { enabled = value; parent->apply_config(); }
+        void set_gpio_num(uint16_t value) { gpio_num = value; parent->apply_config(); }
+    };
+
+    // Looks for a configured position in the half-open range between from and
+    // to (either direction). On a match returns the crossed position closest
+    // to to, and the number of positions crossed.
+    // All comparisons are made on distances relative to from, so they keep
+    // their resolution far away from zero.
+    static size_t find_crossing(const Config_t& config, SplitPosition from, SplitPosition to, SplitPosition* crossed) {
+        float delta = to - from;
+        if (config.mode == MODE_INTERVAL) {
+            if (!(config.interval > 0.0f)) {
+                return 0;
+            }
+            // Cells [interval_start + k * interval, interval_start + (k + 1) * interval)
+            // are counted relative to the one that contains from
+            float phase = interval_phase(config, from);
+            int32_t cells = (int32_t)std::floor((phase + delta) / config.interval);
+            if (cells == 0) {
+                return 0;
+            }
+            // Crossed boundary closest to to: moving down it is the upper edge of to's cell
+            int32_t k = (cells > 0) ? cells : cells + 1;
+            *crossed = from + ((float)k * config.interval - phase);
+            return (size_t)std::abs(cells);
+        }
+
+        size_t count = 0;
+        float closest = 0.0f;
+        size_t n = config.num_positions < MAX_POSITIONS ? config.num_positions : MAX_POSITIONS;
+        for (size_t i = 0; i < n; ++i) {
+            float p = SplitPosition::from_float(config.positions[i]) - from;
+            bool hit = (delta > 0.0f) ? (0.0f < p && p <= delta) : (delta < p && p <= 0.0f);
+            if (hit) {
+                if (count == 0 || std::abs(delta - p) < std::abs(delta - closest)) {
+                    closest = p;
+                }
+                ++count;
+            }
+        }
+        if (count > 0) {
+            *crossed = from + closest;
+        }
+        return count;
+    }
+
+    // Distance of pos from the start of the interval cell that contains it.
+    // Whole turns are reduced modulo the interval first, so only small numbers
+    // reach the float arithmetic.
+    static float interval_phase(const Config_t& config, SplitPosition pos) {
+        SplitPosition start = SplitPosition::from_float(config.interval_start);
+        float rem = std::fmod((float)(pos.integer - start.integer), config.interval);  // exact
+        float x = rem + (pos.fraction - start.fraction);
+        return x - std::floor(x / config.interval) * config.interval;
+    }
+
+    bool apply_config();
+    void update();
+
+    Config_t config_;
+    Axis* axis_ = nullptr; // set by Axis constructor
+
+    uint32_t trigger_count_ = 0;
+    float last_trigger_pos_ = 0.0f;   // [turn]
+    // Interpolated crossing time: control tick of the output edge plus the
+    // offset of the actual crossing from that tick (within +-0.5 periods).
+    // Kept as an integer so it does not lose resolution with uptime.
+    uint32_t last_trigger_tick_ = 0;
+    float last_trigger_offset_ = 0.0f; // [s]
+    uint32_t tick_count_ = 0;          // control ticks since the configuration was applied
+
+   private:
+    void write(bool active);
+
+    bool primed_ = false;
+    bool output_active_ = false;
+    SplitPosition lookahead_pos_;     // [turn] position estimate half a period ahead
+    float pulse_remaining_ = 0.0f;    // [s]
+};
+
+#endif // __POSITION_COMPARE_HPP
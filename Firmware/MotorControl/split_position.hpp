@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+// Position split into an integer part and a fractional part in [0, 1).
+// A float position loses resolution as it grows (at 2^24 counts it can no
+// longer represent single counts). Keeping the integer part separately keeps
+// the resolution of the fraction constant over the whole travel. Differences
+// between two nearby split positions are exact enough to be handled as float.
+struct SplitPosition {
+    int32_t integer = 0;
+    float fraction = 0.0f;  // [0, 1)
+
+    static SplitPosition from_float(float value) {
+        SplitPosition result;
+        float integer = std::floor(value);
+        result.integer = (int32_t)integer;
+        result.fraction = value - integer;
+        result.normalize();
+        return result;
+    }
+
+    // Converts a position in encoder counts to turns
+    SplitPosition to_turns(int32_t cpr) const {
+        int32_t turns = integer / cpr;
+        int32_t rem = integer - turns * cpr;
+        if (rem < 0) {
+            rem += cpr;
+            turns -= 1;
+        }
+        SplitPosition result;
+        result.integer = turns;
+        result.fraction = ((float)rem + fraction) / (float)cpr;
+        result.normalize();
+        return result;
+    }
+
+    float to_float() const {
+        return (float)integer + fraction;
+    }
+
+    SplitPosition& operator+=(float delta) {
+        fraction += delta;
+        normalize();
+        return *this;
+    }
+
+    SplitPosition operator+(float delta) const {
+        SplitPosition result = *this;
+        result += delta;
+        return result;
+    }
+
+    // Distance between two positions. Only the distance is converted to float.
+    float operator-(const SplitPosition& other) const {
+        return (float)(integer - other.integer) + (fraction - other.fraction);
+    }
+
+    bool operator==(const SplitPosition& other) const {
+        return integer == other.integer && fraction == other.fraction;
+    }
+
+    bool operator!=(const SplitPosition& other) const {
+        return !(*this == other);
+    }
+
+   private:
+    void normalize() {
+        float carry = std::floor(fraction);
+        integer += (int32_t)carry;
+        fraction -= carry;
+        // A tiny negative fraction can round up to exactly 1.0f
+        if (fraction >= 1.0f) {
+            fraction -= 1.0f;
+            integer += 1;
+        }
+    }
+};
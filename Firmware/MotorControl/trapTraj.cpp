@@ -63,6 +63,24 @@ bool TrapezoidalTrajectory::planTrapezoidal(float Xf, float Xi, float Vi,
     return true;
 }
 
+/**按比例复制一条归一化路径轨迹（0 到 1）：eval() 返回 Xi + dX * path.eval()。
+ * 多轴共用同一条路径轨迹时，各轴的时间阶段完全相同，合成路径是一条直线。*/
+// eval() is linear in the stored positions, velocities and accelerations,
+// so scaling them scales the whole profile while keeping its timing.
+void TrapezoidalTrajectory::planScaled(const TrapezoidalTrajectory& path, float Xi, float dX) {
+    Xi_ = Xi + dX * path.Xi_;
+    Xf_ = Xi + dX * path.Xf_;
+    Vi_ = dX * path.Vi_;
+    Ar_ = dX * path.Ar_;
+    Vr_ = dX * path.Vr_;
+    Dr_ = dX * path.Dr_;
+    Ta_ = path.Ta_;
+    Tv_ = path.Tv_;
+    Td_ = path.Td_;
+    Tf_ = path.Tf_;
+    yAccel_ = Xi + dX * path.yAccel_;
+}
+
 TrapezoidalTrajectory::Step_t TrapezoidalTrajectory::eval(float t) {
     Step_t trajStep;
     if (t < 0.0f) {  // Initial Condition
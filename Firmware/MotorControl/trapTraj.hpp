@@ -17,6 +17,7 @@ public:
 
     bool planTrapezoidal(float Xf, float Xi, float Vi,
                          float Vmax, float Amax, float Dmax);
+    void planScaled(const TrapezoidalTrajectory& path, float Xi, float dX);
     Step_t eval(float t);
 
     Axis* axis_ = nullptr;  // set by Axis constructor
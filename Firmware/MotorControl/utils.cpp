@@ -1,16 +1,23 @@
 
 #include <utils.hpp>
 #include <board.h>
+#include "overmodulation.hpp"
 
 
 // Compute rising edge timings (0.0 - 1.0) as a function of alpha-beta
 // as per the magnitude invariant clarke transform
-// The magnitude of the alpha-beta vector may not be larger than sqrt(3)/2
+// The magnitude of the alpha-beta vector may not be larger than sqrt(3)/2,
+// unless overmodulation is true: larger vectors are then mapped onto the
+// hexagon (mode I/II, up to six-step) with the same fundamental.
 // Returns true on success, and false if the input was out of range
-std::tuple<float, float, float, bool> SVM(float alpha, float beta) {
+std::tuple<float, float, float, bool> SVM(float alpha, float beta, bool overmodulation) {
     float tA, tB, tC;
     int Sextant;
 
+    if (overmodulation) {
+        overmodulation = overmodulation::apply(&alpha, &beta);
+    }
+
     if (beta >= 0.0f) {
 
         /**矢量处在扇区1的充分必要条件是：Uα＞0，Uβ＞0，√3Uα-Uβ＞0*/
@@ -131,6 +138,13 @@ std::tuple<float, float, float, bool> SVM(float alpha, float beta) {
         } break;
     }
 
+    if (overmodulation) {
+        // The vector is on the hexagon, only rounding errors can be outside of [0, 1]
+        tA = std::clamp(tA, 0.0f, 1.0f);
+        tB = std::clamp(tB, 0.0f, 1.0f);
+        tC = std::clamp(tC, 0.0f, 1.0f);
+    }
+
     bool result_valid =
             tA >= 0.0f && tA <= 1.0f
          && tB >= 0.0f && tB <= 1.0f
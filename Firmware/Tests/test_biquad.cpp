@@ -0,0 +1,63 @@
+#include <doctest.h>
+#include "MotorControl/biquad.hpp"
+
+#include <cmath>
+
+using doctest::Approx;
+
+// Runs a sine through the filter and returns the steady state output amplitude
+static float sine_gain(Biquad& filter, float frequency, float sample_rate) {
+    filter.reset();
+    float peak = 0.0f;
+    const int n = (int)(sample_rate * 2.0f);
+    for (int i = 0; i < n; ++i) {
+        float y = filter.update(std::sin(2.0f * (float)M_PI * frequency * (float)i / sample_rate));
+        if (i > n / 2)
+            peak = std::max(peak, std::abs(y));
+    }
+    return peak;
+}
+
+TEST_SUITE("biquad") {
+    const float fs = 8000.0f;
+
+    TEST_CASE("passthrough") {
+        Biquad filter;
+        CHECK(filter.update(1.5f) == 1.5f);
+
+        filter.configure(Biquad::TYPE_LOWPASS, 100.0f, 0.707f, fs);
+        filter.configure(Biquad::TYPE_NONE, 100.0f, 0.707f, fs);
+        filter.reset();
+        CHECK(filter.update(-2.0f) == -2.0f);
+
+        // Out of range parameters fall back to passthrough
+        filter.configure(Biquad::TYPE_NOTCH, 5000.0f, 1.0f, fs);
+        CHECK(filter.update(3.0f) == 3.0f);
+        filter.configure(Biquad::TYPE_NOTCH, 100.0f, 0.0f, fs);
+        CHECK(filter.update(3.0f) == 3.0f);
+    }
+
+    TEST_CASE("lowpass") {
+        Biquad filter;
+        filter.configure(Biquad::TYPE_LOWPASS, 100.0f, 0.707f, fs);
+
+        // Unity DC gain
+        float y = 0.0f;
+        for (int i = 0; i < 4000; ++i)
+            y = filter.update(1.0f);
+        CHECK(y == Approx(1.0f).epsilon(1e-4));
+
+        CHECK(sine_gain(filter, 10.0f, fs) == Approx(1.0f).epsilon(0.01));
+        CHECK(sine_gain(filter, 100.0f, fs) == Approx(0.707f).epsilon(0.02));
+        CHECK(sine_gain(filter, 1000.0f, fs) < 0.02f);
+    }
+
+    TEST_CASE("notch") {
+        Biquad filter;
+        filter.configure(Biquad::TYPE_NOTCH, 200.0f, 2.0f, fs);
+
+        CHECK(sine_gain(filter, 200.0f, fs) < 0.01f);
+        CHECK(sine_gain(filter, 10.0f, fs) == Approx(1.0f).epsilon(0.01));
+        CHECK(sine_gain(filter, 2000.0f, fs) == Approx(1.0f).epsilon(0.01));
+    }
+}
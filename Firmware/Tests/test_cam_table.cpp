@@ -0,0 +1,44 @@
+#include <doctest.h>
+#include "MotorControl/cam_table.hpp"
+
+#include <cmath>
+
+using doctest::Approx;
+
+TEST_SUITE("cam_table") {
+    TEST_CASE("passes through the table points") {
+        const float points[] = {0.0f, 0.5f, 0.25f, -0.1f};
+        for (int i = 0; i < 4; ++i) {
+            CamTable::Output out = CamTable::eval(points, 4, 2.0f, 0.0f, 0.5f * i);
+            CHECK(out.pos == Approx(points[i]));
+        }
+        // Periodic, also for negative master positions
+        CHECK(CamTable::eval(points, 4, 2.0f, 0.0f, 2.5f).pos == Approx(0.5f));
+        CHECK(CamTable::eval(points, 4, 2.0f, 0.0f, -1.5f).pos == Approx(0.5f));
+    }
+
+    TEST_CASE("linear profile is geared motion") {
+        // A table with a rise per cycle and evenly spaced points is a 1:1 gear
+        const float points[] = {0.0f, 0.25f, 0.5f, 0.75f};
+        for (float master = -3.0f; master < 3.0f; master += 0.137f) {
+            CamTable::Output out = CamTable::eval(points, 4, 1.0f, 1.0f, master);
+            CHECK(out.pos == Approx(master).epsilon(1e-5));
+            CHECK(out.slope == Approx(1.0f).epsilon(1e-4));
+        }
+    }
+
+    TEST_CASE("slope matches the profile derivative") {
+        const size_t n = 16;
+        float points[n];
+        for (size_t i = 0; i < n; ++i)
+            points[i] = std::sin(2.0f * (float)M_PI * (float)i / (float)n);
+
+        const float h = 1e-3f;
+        for (float master = 0.0f; master < 1.0f; master += 0.05f) {
+            float numeric = (CamTable::eval(points, n, 1.0f, 0.0f, master + h).pos
+                           - CamTable::eval(points, n, 1.0f, 0.0f, master - h).pos) / (2.0f * h);
+            CHECK(CamTable::eval(points, n, 1.0f, 0.0f, master).slope == Approx(numeric).epsilon(2e-3));
+            CHECK(CamTable::eval(points, n, 1.0f, 0.0f, master).pos == Approx(std::sin(2.0f * (float)M_PI * master)).epsilon(0.01));
+        }
+    }
+}
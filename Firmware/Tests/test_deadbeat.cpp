@@ -0,0 +1,81 @@
+#include <doctest.h>
+#include "MotorControl/deadbeat.hpp"
+
+#include <cmath>
+#include <initializer_list>
+
+using doctest::Approx;
+
+static DeadbeatCurrentRegulator make_regulator(float gain) {
+    DeadbeatCurrentRegulator reg;
+    reg.R_ = 0.05f;
+    reg.Ld_ = 20e-6f;
+    reg.Lq_ = 30e-6f;
+    reg.flux_linkage_ = 0.005f;
+    reg.gain_ = gain;
+    reg.Ts_ = 125e-6f;
+    return reg;
+}
+
+// Runs the regulator against the continuous motor model (fine integration
+// steps) with one period of computation delay. Returns the current sampled
+// at the start of each period.
+template<size_t N>
+static void run(DeadbeatCurrentRegulator& reg, float w, float Id_sp, float Iq_sp,
+                float (&Id_out)[N], float (&Iq_out)[N]) {
+    constexpr int substeps = 100;
+    double Id = 0.0, Iq = 0.0;
+    double Vd_out = 0.0, Vq_out = 0.0;
+    for (size_t k = 0; k < N; ++k) {
+        Id_out[k] = (float)Id;
+        Iq_out[k] = (float)Iq;
+        auto [Vd, Vq] = reg.get_voltage({(float)Id, (float)Iq}, {Id_sp, Iq_sp}, w);
+        reg.set_applied_voltage({Vd, Vq});
+
+        double dt = reg.Ts_ / substeps;
+        for (int i = 0; i < substeps; ++i) {
+            double dId = (Vd_out - reg.R_ * Id + w * reg.Lq_ * Iq) / reg.Ld_;
+            double dIq = (Vq_out - reg.R_ * Iq - w * reg.Ld_ * Id - w * reg.flux_linkage_) / reg.Lq_;
+            Id += dId * dt;
+            Iq += dIq * dt;
+        }
+        Vd_out = Vd;
+        Vq_out = Vq;
+    }
+}
+
+TEST_SUITE("deadbeat") {
+    TEST_CASE("prediction at standstill") {
+        DeadbeatCurrentRegulator reg = make_regulator(1.0f);
+        auto [Id, Iq] = reg.predict({1.0f, 2.0f}, {0.5f, 1.0f}, 0.0f);
+        // First order step response towards V / R
+        float kd = std::exp(-0.05f * 125e-6f / 20e-6f);
+        float kq = std::exp(-0.05f * 125e-6f / 30e-6f);
+        CHECK(Id == Approx(1.0f * kd + 0.5f / 0.05f * (1.0f - kd)).epsilon(1e-3));
+        CHECK(Iq == Approx(2.0f * kq + 1.0f / 0.05f * (1.0f - kq)).epsilon(1e-3));
+    }
+
+    TEST_CASE("reaches the setpoint after two periods") {
+        for (float w: {0.0f, 1000.0f, 3000.0f}) {
+            DeadbeatCurrentRegulator reg = make_regulator(1.0f);
+            float Id[8], Iq[8];
+            run(reg, w, -2.0f, 10.0f, Id, Iq);
+            for (size_t k = 2; k < 8; ++k) {
+                CHECK(Id[k] == Approx(-2.0f).epsilon(0.05));
+                CHECK(Iq[k] == Approx(10.0f).epsilon(0.05));
+            }
+        }
+    }
+
+    TEST_CASE("partial gain converges without overshoot") {
+        DeadbeatCurrentRegulator reg = make_regulator(0.5f);
+        float Id[16], Iq[16];
+        run(reg, 0.0f, 0.0f, 10.0f, Id, Iq);
+        CHECK(Iq[2] == Approx(5.0f).epsilon(0.05));
+        for (size_t k = 1; k < 16; ++k) {
+            CHECK(Iq[k] >= Iq[k - 1]);
+            CHECK(Iq[k] <= 10.0f * 1.001f);
+        }
+        CHECK(Iq[15] == Approx(10.0f).epsilon(0.01));
+    }
+}
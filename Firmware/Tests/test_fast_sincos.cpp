@@ -0,0 +1,80 @@
+#include <doctest.h>
+#include "MotorControl/fast_sincos.hpp"
+
+#include <cmath>
+
+// Host copy of the table lookup used by our_arm_sin_f32 / our_arm_cos_f32
+// (256 entries, linear interpolation), as the reference for the comparison.
+struct TableSinCos {
+    static constexpr int TABLE_SIZE = 256;
+    float table[TABLE_SIZE + 1];
+
+    TableSinCos() {
+        for (int i = 0; i <= TABLE_SIZE; ++i) {
+            table[i] = (float)std::sin(2.0 * M_PI * i / TABLE_SIZE);
+        }
+    }
+
+    float lookup(float in) const {
+        int32_t n = (int32_t)in;
+        if (in < 0.0f) {
+            n--;
+        }
+        in -= (float)n;
+        float findex = (float)TABLE_SIZE * in;
+        uint16_t index = (uint16_t)findex;
+        if (index >= TABLE_SIZE) {
+            index = 0;
+            findex -= (float)TABLE_SIZE;
+        }
+        float fract = findex - (float)index;
+        return (1.0f - fract) * table[index] + fract * table[index + 1];
+    }
+
+    float sin(float x) const { return lookup(x * 0.159154943092f); }
+    float cos(float x) const { return lookup(x * 0.159154943092f + 0.25f); }
+};
+
+TEST_SUITE("fast_sincos") {
+    TEST_CASE("accuracy") {
+        TableSinCos ref;
+        double max_err = 0.0;
+        double max_err_table = 0.0;
+        for (int i = -200000; i <= 200000; ++i) {
+            float x = i * 1e-4f;
+            SinCos sc = fast_sincos(x);
+            max_err = std::fmax(max_err, std::fabs(sc.sin - std::sin((double)x)));
+            max_err = std::fmax(max_err, std::fabs(sc.cos - std::cos((double)x)));
+            max_err_table = std::fmax(max_err_table, std::fabs(ref.sin(x) - std::sin((double)x)));
+            max_err_table = std::fmax(max_err_table, std::fabs(ref.cos(x) - std::cos((double)x)));
+        }
+        MESSAGE("max error fast_sincos: " << max_err << ", table: " << max_err_table);
+        CHECK(max_err < 5e-7);
+        CHECK(max_err < max_err_table);
+    }
+
+    TEST_CASE("quadrant boundaries") {
+        for (int k = -8; k <= 8; ++k) {
+            double x = k * M_PI / 4.0;
+            SinCos sc = fast_sincos((float)x);
+            CHECK(std::fabs(sc.sin - std::sin(x)) < 5e-7);
+            CHECK(std::fabs(sc.cos - std::cos(x)) < 5e-7);
+        }
+    }
+
+    TEST_CASE("small-angle rotation") {
+        double max_err = 0.0;
+        for (int i = -100; i <= 100; ++i) {
+            float x = i * 0.0613f;
+            SinCos sc = fast_sincos(x);
+            for (int j = -50; j <= 50; ++j) {
+                float delta = j * (SMALL_ANGLE_MAX / 50.0f);
+                SinCos rotated = rotate_sincos(sc, delta);
+                max_err = std::fmax(max_err, std::fabs(rotated.sin - std::sin((double)x + delta)));
+                max_err = std::fmax(max_err, std::fabs(rotated.cos - std::cos((double)x + delta)));
+            }
+        }
+        MESSAGE("max error rotate_sincos: " << max_err);
+        CHECK(max_err < 2e-6);
+    }
+}
@@ -0,0 +1,45 @@
+#include <doctest.h>
+#include "communication/gcode.hpp"
+
+using doctest::Approx;
+
+TEST_SUITE("gcode") {
+    TEST_CASE("words") {
+        GCodeLine line;
+        REQUIRE(line.parse("N10 G1 X1.5 Y-2 F600"));
+        CHECK(line.num_g_codes == 1);
+        CHECK(line.g_codes[0] == 1);
+        CHECK(line.has('X'));
+        CHECK(line.get('X', 0.0f) == Approx(1.5f));
+        CHECK(line.get('Y', 0.0f) == Approx(-2.0f));
+        CHECK(line.get('F', 0.0f) == Approx(600.0f));
+        CHECK(!line.has('Z'));
+        CHECK(line.get('Z', 3.0f) == 3.0f);
+    }
+
+    TEST_CASE("modal codes on one line") {
+        GCodeLine line;
+        REQUIRE(line.parse("g91 g0 x.5"));
+        CHECK(line.num_g_codes == 2);
+        CHECK(line.g_codes[0] == 91);
+        CHECK(line.g_codes[1] == 0);
+        CHECK(line.get('X', 0.0f) == Approx(0.5f));
+    }
+
+    TEST_CASE("reparse clears the previous line") {
+        GCodeLine line;
+        REQUIRE(line.parse("G1 X1 Y1"));
+        REQUIRE(line.parse("M17"));
+        CHECK(line.num_g_codes == 0);
+        CHECK(!line.has('X'));
+        CHECK(line.get('M', -1.0f) == 17.0f);
+    }
+
+    TEST_CASE("syntax errors") {
+        GCodeLine line;
+        CHECK(!line.parse("G1 X"));
+        CHECK(!line.parse("G1 X1 #"));
+        CHECK(!line.parse("G1 G1 G1 G1 G1"));
+        CHECK(line.parse(""));
+    }
+}
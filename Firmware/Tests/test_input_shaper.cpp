@@ -0,0 +1,128 @@
+#include <doctest.h>
+#include "MotorControl/input_shaper.hpp"
+
+#include <cmath>
+#include <initializer_list>
+
+using doctest::Approx;
+
+// Drives an undamped oscillator (natural frequency f) with a shaped position
+// step and returns the residual vibration amplitude after the shaper settled.
+static float residual_vibration(InputShaper::Type type, float shaper_freq, float f, float dt) {
+    InputShaper shaper;
+    shaper.configure(type, shaper_freq, 0.0f, dt);
+    shaper.reset({0.0f, 0.0f, 0.0f});
+
+    const float w = 2.0f * (float)M_PI * f;
+    float x = 0.0f, v = 0.0f, peak = 0.0f;
+    const int n = (int)(3.0f / dt);
+    for (int i = 0; i < n; ++i) {
+        float u = shaper.update({1.0f, 0.0f, 0.0f}).pos;
+        v += dt * w * w * (u - x);
+        x += dt * v;
+        if (i > n / 2)
+            peak = std::max(peak, std::abs(x - 1.0f));
+    }
+    return peak;
+}
+
+// Same for an oscillator with damping ratio zeta, shaped for shaper_zeta.
+// Returns the residual vibration relative to the unshaped response in the
+// period after the shaper settled.
+static float damped_residual_ratio(InputShaper::Type type, float shaper_zeta, float f, float zeta, float dt) {
+    InputShaper shaper;
+    shaper.configure(type, f, shaper_zeta, dt);
+    shaper.reset({0.0f, 0.0f, 0.0f});
+
+    const float w = 2.0f * (float)M_PI * f;
+    float x = 0.0f, v = 0.0f, x0 = 0.0f, v0 = 0.0f, peak = 0.0f, peak0 = 0.0f;
+    const int start = (int)(1.5f / f / dt);
+    const int n = start + (int)(1.0f / f / dt);
+    for (int i = 0; i < n; ++i) {
+        float u = shaper.update({1.0f, 0.0f, 0.0f}).pos;
+        v += dt * (w * w * (u - x) - 2.0f * zeta * w * v);
+        x += dt * v;
+        v0 += dt * (w * w * (1.0f - x0) - 2.0f * zeta * w * v0);
+        x0 += dt * v0;
+        if (i >= start) {
+            peak = std::max(peak, std::abs(x - 1.0f));
+            peak0 = std::max(peak0, std::abs(x0 - 1.0f));
+        }
+    }
+    return peak / peak0;
+}
+
+TEST_SUITE("input_shaper") {
+    const float dt = 1.0f / 8000.0f;
+
+    TEST_CASE("disabled") {
+        InputShaper shaper;
+        CHECK(!shaper.configure(InputShaper::TYPE_NONE, 10.0f, 0.0f, dt));
+        CHECK(!shaper.configure(InputShaper::TYPE_ZV, 0.0f, 0.0f, dt));
+        CHECK(!shaper.configure(InputShaper::TYPE_ZV, 10.0f, 1.0f, dt));
+        CHECK(!shaper.enabled());
+    }
+
+    TEST_CASE("step response") {
+        InputShaper shaper;
+        REQUIRE(shaper.configure(InputShaper::TYPE_ZV, 50.0f, 0.0f, dt));
+        shaper.reset({0.0f, 0.0f, 0.0f});
+
+        // Half of the step passes immediately, the rest after half a period
+        CHECK(shaper.update({1.0f, 2.0f, 3.0f}).pos == Approx(0.5f));
+        for (int i = 0; i < 79; ++i)
+            CHECK(shaper.update({1.0f, 2.0f, 3.0f}).pos == Approx(0.5f));
+        InputShaper::Sample out = shaper.update({1.0f, 2.0f, 3.0f});
+        CHECK(out.pos == Approx(1.0f));
+        CHECK(out.vel == Approx(2.0f));
+        CHECK(out.torque == Approx(3.0f));
+    }
+
+    TEST_CASE("decimated delay line") {
+        // 1 Hz needs more delay than the history holds without decimation
+        InputShaper shaper;
+        REQUIRE(shaper.configure(InputShaper::TYPE_ZVD, 1.0f, 0.1f, dt));
+        shaper.reset({0.0f, 0.0f, 0.0f});
+        float y = 0.0f, prev = 0.0f;
+        for (int i = 0; i < 16000; ++i) {
+            y = shaper.update({1.0f, 0.0f, 0.0f}).pos;
+            CHECK(y >= prev - 1e-6f);  // monotonic for a positive shaper
+            prev = y;
+        }
+        CHECK(y == Approx(1.0f));
+    }
+
+    TEST_CASE("settling time") {
+        for (float f: {50.0f, 1.0f}) {
+            InputShaper shaper;
+            REQUIRE(shaper.configure(InputShaper::TYPE_ZVD, f, 0.1f, dt));
+            shaper.reset({0.0f, 0.0f, 0.0f});
+            uint32_t n = shaper.settling_ticks();
+            float y = 0.0f;
+            for (uint32_t i = 0; i < n; ++i)
+                y = shaper.update({1.0f, 0.0f, 0.0f}).pos;
+            CHECK(y == Approx(1.0f));
+        }
+    }
+
+    TEST_CASE("vibration suppression") {
+        float unshaped = residual_vibration(InputShaper::TYPE_NONE, 10.0f, 10.0f, dt);
+        CHECK(unshaped == Approx(1.0f).epsilon(0.05));
+        CHECK(residual_vibration(InputShaper::TYPE_ZV, 10.0f, 10.0f, dt) < 0.02f);
+        CHECK(residual_vibration(InputShaper::TYPE_ZVD, 10.0f, 10.0f, dt) < 0.02f);
+        CHECK(residual_vibration(InputShaper::TYPE_EI, 10.0f, 10.0f, dt) < 0.07f);
+        // ZVD and EI tolerate a frequency error
+        CHECK(residual_vibration(InputShaper::TYPE_ZVD, 10.0f, 11.0f, dt) < 0.05f);
+        CHECK(residual_vibration(InputShaper::TYPE_EI, 10.0f, 11.0f, dt) < 0.07f);
+    }
+
+    TEST_CASE("damped mode") {
+        // Shaping for the actual damping beats shaping for an undamped mode
+        for (auto type: {InputShaper::TYPE_ZV, InputShaper::TYPE_ZVD, InputShaper::TYPE_EI}) {
+            float matched = damped_residual_ratio(type, 0.1f, 10.0f, 0.1f, dt);
+            float ignored = damped_residual_ratio(type, 0.0f, 10.0f, 0.1f, dt);
+            CHECK(matched < 0.07f);
+            CHECK(matched < ignored);
+        }
+    }
+}
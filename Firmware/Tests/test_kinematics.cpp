@@ -0,0 +1,62 @@
+#include <doctest.h>
+#include "MotorControl/kinematics.hpp"
+
+using doctest::Approx;
+
+TEST_SUITE("kinematics") {
+    TEST_CASE("disabled") {
+        Kinematics kinematics;
+        Kinematics::Config_t config;
+        CHECK(!kinematics.configure(config));
+
+        // Singular custom matrix
+        config.type = Kinematics::TYPE_CUSTOM;
+        config.matrix[0] = 1.0f; config.matrix[1] = 2.0f;
+        config.matrix[2] = 2.0f; config.matrix[3] = 4.0f;
+        CHECK(!kinematics.configure(config));
+        CHECK(!kinematics.enabled());
+    }
+
+    TEST_CASE("corexy") {
+        Kinematics kinematics;
+        Kinematics::Config_t config;
+        config.type = Kinematics::TYPE_COREXY;
+        config.scale = 2.0f;
+        REQUIRE(kinematics.configure(config));
+
+        // Pure X moves both motors the same way, pure Y moves them apart
+        float joint[2] = {1.0f, 0.0f}, motor[2];
+        kinematics.to_motor(joint, motor);
+        CHECK(motor[0] == Approx(2.0f));
+        CHECK(motor[1] == Approx(2.0f));
+        joint[0] = 0.0f; joint[1] = 1.0f;
+        kinematics.to_motor(joint, motor);
+        CHECK(motor[0] == Approx(2.0f));
+        CHECK(motor[1] == Approx(-2.0f));
+
+        // Round trip
+        joint[0] = 0.3f; joint[1] = -1.7f;
+        float back[2];
+        kinematics.to_motor(joint, motor);
+        kinematics.to_joint(motor, back);
+        CHECK(back[0] == Approx(0.3f));
+        CHECK(back[1] == Approx(-1.7f));
+    }
+
+    TEST_CASE("force to torque conserves power") {
+        Kinematics kinematics;
+        Kinematics::Config_t config;
+        config.type = Kinematics::TYPE_CUSTOM;
+        config.scale = 1.5f;
+        config.matrix[0] = 1.0f; config.matrix[1] = 0.5f;
+        config.matrix[2] = -0.25f; config.matrix[3] = 2.0f;
+        REQUIRE(kinematics.configure(config));
+
+        float joint_vel[2] = {0.7f, -0.2f}, force[2] = {3.0f, 5.0f};
+        float motor_vel[2], torque[2];
+        kinematics.to_motor(joint_vel, motor_vel);
+        kinematics.force_to_torque(force, torque);
+        CHECK(torque[0] * motor_vel[0] + torque[1] * motor_vel[1]
+              == Approx(force[0] * joint_vel[0] + force[1] * joint_vel[1]));
+    }
+}
@@ -0,0 +1,208 @@
+#include <doctest.h>
+#include "MotorControl/motion_queue.hpp"
+
+#include <vector>
+
+using doctest::Approx;
+
+static MotionQueue::Command_t move(float x, float y, float rate) {
+    return {MotionQueue::COMMAND_MOVE, {x, y}, rate};
+}
+
+// Translates one line like AsciiProtocol::cmd_gcode() does
+static MotionQueue::GCodeError translate(const char* str, MotionQueue::GCodeState_t& state,
+                                         std::vector<MotionQueue::Command_t>* commands, int* code = nullptr) {
+    GCodeLine line;
+    REQUIRE(line.parse(str));
+    MotionQueue::Command_t buf[MotionQueue::MAX_LINE_COMMANDS];
+    size_t n = 0;
+    int unsupported = 0;
+    MotionQueue::GCodeError error = MotionQueue::translate(line, state, 2.0f, buf, &n, &unsupported);
+    if (error == MotionQueue::GCODE_OK) {
+        commands->insert(commands->end(), buf, buf + n);
+    }
+    if (code) {
+        *code = unsupported;
+    }
+    return error;
+}
+
+TEST_SUITE("motion_queue") {
+    TEST_CASE("command order") {
+        MotionQueue::GCodeState_t state;
+        std::vector<MotionQueue::Command_t> commands;
+        REQUIRE(translate("G1 X1 F60 G4 P250 G0 Y2 M18", state, &commands) == MotionQueue::GCODE_OK);
+        REQUIRE(translate("M17", state, &commands) == MotionQueue::GCODE_OK);
+        REQUIRE(translate("G28", state, &commands) == MotionQueue::GCODE_OK);
+        REQUIRE(commands.size() == 6);
+        CHECK(commands[0].type == MotionQueue::COMMAND_MOVE);
+        CHECK(commands[0].value == Approx(1.0f));
+        CHECK(commands[1].type == MotionQueue::COMMAND_DWELL);
+        CHECK(commands[2].type == MotionQueue::COMMAND_MOVE);
+        CHECK(commands[2].value == 2.0f);  // G0 uses the rapid rate
+        CHECK(commands[2].target == std::array<float, 2>{1.0f, 2.0f});
+        CHECK(commands[3].type == MotionQueue::COMMAND_DISABLE);
+        CHECK(commands[4].type == MotionQueue::COMMAND_ENABLE);
+        CHECK(commands[5].type == MotionQueue::COMMAND_HOME);
+        CHECK(state.planned_pos == std::array<float, 2>{0.0f, 0.0f});
+
+        // Reports and waits queue nothing
+        REQUIRE(translate("M114", state, &commands) == MotionQueue::GCODE_OK);
+        REQUIRE(translate("M400", state, &commands) == MotionQueue::GCODE_OK);
+        CHECK(commands.size() == 6);
+    }
+
+    TEST_CASE("absolute and relative positions") {
+        MotionQueue::GCodeState_t state;
+        state.planned_pos = {0.5f, 0.5f};
+        std::vector<MotionQueue::Command_t> commands;
+        REQUIRE(translate("G1 X1 F120", state, &commands) == MotionQueue::GCODE_OK);
+        REQUIRE(translate("G91 G1 X1 Y-1", state, &commands) == MotionQueue::GCODE_OK);
+        REQUIRE(translate("G1 Y0.25", state, &commands) == MotionQueue::GCODE_OK);  // G91 is modal
+        REQUIRE(translate("G90", state, &commands) == MotionQueue::GCODE_OK);
+        REQUIRE(translate("G1 X3", state, &commands) == MotionQueue::GCODE_OK);
+        REQUIRE(commands.size() == 4);
+        CHECK(commands[0].target == std::array<float, 2>{1.0f, 0.5f});  // Y keeps the planned position
+        CHECK(commands[1].target == std::array<float, 2>{2.0f, -0.5f});
+        CHECK(commands[2].target == std::array<float, 2>{2.0f, -0.25f});
+        CHECK(commands[3].target == std::array<float, 2>{3.0f, -0.25f});
+        CHECK(commands[3].value == Approx(2.0f));  // F is modal too
+        CHECK(state.absolute);
+        CHECK(state.planned_pos == commands[3].target);
+
+        // G90/G91 apply to the moves after them on the same line
+        REQUIRE(translate("G91 G1 X1 G90 G1 X1", state, &commands) == MotionQueue::GCODE_OK);
+        CHECK(commands[4].target[0] == 4.0f);
+        CHECK(commands[5].target[0] == 1.0f);
+    }
+
+    TEST_CASE("dwell") {
+        MotionQueue::GCodeState_t state;
+        std::vector<MotionQueue::Command_t> commands;
+        REQUIRE(translate("G4 P1500", state, &commands) == MotionQueue::GCODE_OK);
+        REQUIRE(translate("G4 S0.25", state, &commands) == MotionQueue::GCODE_OK);
+        REQUIRE(translate("G4", state, &commands) == MotionQueue::GCODE_OK);
+        REQUIRE(commands.size() == 3);
+        for (auto& command: commands) {
+            CHECK(command.type == MotionQueue::COMMAND_DWELL);
+        }
+        CHECK(commands[0].value == Approx(1.5f));
+        CHECK(commands[1].value == Approx(0.25f));
+        CHECK(commands[2].value == 0.0f);
+        // A dwell does not move the planned position
+        CHECK(state.planned_pos == std::array<float, 2>{0.0f, 0.0f});
+    }
+
+    TEST_CASE("rejected lines leave the state unchanged") {
+        MotionQueue::GCodeState_t state;
+        std::vector<MotionQueue::Command_t> commands;
+        int code = 0;
+        CHECK(translate("N5 X10", state, &commands) == MotionQueue::GCODE_NO_COMMAND);
+        CHECK(translate("G91 G1 X1 G2 X1", state, &commands, &code) == MotionQueue::GCODE_UNSUPPORTED_G);
+        CHECK(code == 2);
+        CHECK(translate("G91 G1 X1 M3", state, &commands, &code) == MotionQueue::GCODE_UNSUPPORTED_M);
+        CHECK(code == 3);
+        CHECK(translate("G91 G1 X1 F0", state, &commands) == MotionQueue::GCODE_INVALID_FEED_RATE);
+        CHECK(commands.empty());
+        CHECK(state.absolute);
+        CHECK(state.feed_rate == 1.0f);
+        CHECK(state.planned_pos == std::array<float, 2>{0.0f, 0.0f});
+
+        // A bare line number does nothing
+        CHECK(translate("N6", state, &commands) == MotionQueue::GCODE_OK);
+        CHECK(commands.empty());
+    }
+
+    TEST_CASE("rest to rest profile") {
+        MotionQueue::Profile_t p = MotionQueue::plan_profile(1.0f, 0.0f, 0.0f, 2.0f, 10.0f);
+        CHECK(p.v_cruise == Approx(2.0f));
+        CHECK(p.t_accel == Approx(0.2f));
+        CHECK(p.duration == Approx(0.7f));
+
+        float pos, vel;
+        MotionQueue::eval_profile(p, p.duration * 0.5f, &pos, &vel);
+        CHECK(pos == Approx(0.5f));
+        CHECK(vel == Approx(2.0f));
+        MotionQueue::eval_profile(p, p.duration, &pos, &vel);
+        CHECK(pos == 1.0f);
+        CHECK(vel == 0.0f);
+
+        // Too short to reach the feed rate
+        p = MotionQueue::plan_profile(0.1f, 0.0f, 0.0f, 2.0f, 10.0f);
+        CHECK(p.v_cruise == Approx(1.0f));
+        CHECK(p.t_cruise == 0.0f);
+        CHECK(p.duration == Approx(0.2f));
+    }
+
+    TEST_CASE("profile with start and end velocity") {
+        MotionQueue::Profile_t p = MotionQueue::plan_profile(1.0f, 1.0f, 2.0f, 2.0f, 10.0f);
+        CHECK(p.t_accel == Approx(0.1f));
+        CHECK(p.v_end == 2.0f);
+        CHECK(p.duration == Approx(0.1f + 0.85f / 2.0f));
+        float pos, vel;
+        MotionQueue::eval_profile(p, 0.0f, &pos, &vel);
+        CHECK(vel == 1.0f);
+        MotionQueue::eval_profile(p, p.duration, &pos, &vel);
+        CHECK(pos == 1.0f);
+        CHECK(vel == 2.0f);
+
+        // An end velocity that can't be reached within the move is lowered
+        p = MotionQueue::plan_profile(0.05f, 0.0f, 2.0f, 2.0f, 10.0f);
+        CHECK(p.v_end == Approx(1.0f));
+        CHECK(p.v_cruise == Approx(1.0f));
+        CHECK(p.duration == Approx(0.1f));
+    }
+
+    TEST_CASE("junction velocity") {
+        std::array<float, 2> from = {0.0f, 0.0f};
+        const float accel = 10.0f;
+
+        // Collinear: limited by the lower feed rate
+        CHECK(MotionQueue::junction_velocity(from, move(1.0f, 1.0f, 2.0f), move(2.0f, 2.0f, 1.5f), accel) == Approx(1.5f));
+        // Collinear, but next is too short to stop from the feed rate
+        CHECK(MotionQueue::junction_velocity(from, move(1.0f, 0.0f, 2.0f), move(1.05f, 0.0f, 2.0f), accel) == Approx(1.0f));
+        // Corner and reversal stop
+        CHECK(MotionQueue::junction_velocity(from, move(1.0f, 0.0f, 2.0f), move(1.0f, 1.0f, 2.0f), accel) == 0.0f);
+        CHECK(MotionQueue::junction_velocity(from, move(1.0f, 0.0f, 2.0f), move(0.0f, 0.0f, 2.0f), accel) == 0.0f);
+        // Zero length moves stop
+        CHECK(MotionQueue::junction_velocity(from, move(0.0f, 0.0f, 2.0f), move(1.0f, 0.0f, 2.0f), accel) == 0.0f);
+    }
+
+    TEST_CASE("collinear moves don't stop at the joint") {
+        // Same planning as MotionQueue::start(): the second move starts at
+        // the end velocity of the first
+        const float accel = 10.0f;
+        const float dt = 1.0f / 8000.0f;
+        std::array<float, 2> from = {0.0f, 0.0f};
+        MotionQueue::Command_t a = move(0.5f, 0.0f, 2.0f);
+        MotionQueue::Command_t b = move(1.0f, 0.0f, 2.0f);
+        float v_joint = MotionQueue::junction_velocity(from, a, b, accel);
+        MotionQueue::Profile_t pa = MotionQueue::plan_profile(0.5f, 0.0f, v_joint, a.value, accel);
+        MotionQueue::Profile_t pb = MotionQueue::plan_profile(0.5f, pa.v_end, 0.0f, b.value, accel);
+        CHECK(pa.v_end == Approx(2.0f));
+
+        // Sample the cruise phase around the joint
+        float last_pos = 0.0f, min_step = 1e9f, max_step = 0.0f, min_vel = 1e9f;
+        for (int i = 0; i < 800; ++i) {
+            float t = pa.duration - 0.05f + i * dt;
+            float pos, vel;
+            if (t < pa.duration) {
+                MotionQueue::eval_profile(pa, t, &pos, &vel);
+            } else {
+                MotionQueue::eval_profile(pb, t - pa.duration, &pos, &vel);
+                pos += a.target[0];
+            }
+            if (i > 0) {
+                min_step = std::min(min_step, pos - last_pos);
+                max_step = std::max(max_step, pos - last_pos);
+            }
+            last_pos = pos;
+            min_vel = std::min(min_vel, vel);
+        }
+        CHECK(min_vel == Approx(2.0f));
+        CHECK(min_step == Approx(2.0f * dt).epsilon(1e-3));
+        CHECK(max_step == Approx(2.0f * dt).epsilon(1e-3));
+        // Same time as a single move over both
+        CHECK(pa.duration + pb.duration == Approx(MotionQueue::plan_profile(1.0f, 0.0f, 0.0f, 2.0f, accel).duration));
+    }
+}
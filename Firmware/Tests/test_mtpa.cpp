@@ -0,0 +1,69 @@
+#include <doctest.h>
+#include "MotorControl/mtpa.hpp"
+
+#include <cmath>
+
+using doctest::Approx;
+
+// Example IPM motor: Kt = 0.1 Nm/A, 4 pole pairs, Lq = 2.5 * Ld
+static constexpr float Kt = 0.1f;
+static constexpr float Ld = 100e-6f;
+static constexpr float Lq = 250e-6f;
+static constexpr float pp = 4.0f;
+
+static float torque_of(float id, float iq) {
+    return iq * (Kt + 1.5f * pp * (Ld - Lq) * id);
+}
+
+TEST_SUITE("mtpa") {
+    TEST_CASE("invalid parameters") {
+        MtpaTable table;
+        CHECK(!table.generate(0.0f, Ld, Lq, pp, 50.0f));
+        CHECK(!table.generate(Kt, 0.0f, Lq, pp, 50.0f));
+        CHECK(!table.generate(Kt, Ld, Lq, pp, 0.0f));
+        CHECK(!table.generate(Kt, Ld, Ld, pp, 50.0f)); // non-salient
+        CHECK(!table.is_valid());
+        CHECK(table.generate(Kt, Ld, Lq, pp, 50.0f));
+        CHECK(table.is_valid());
+    }
+
+    TEST_CASE("produces the requested torque") {
+        MtpaTable table;
+        REQUIRE(table.generate(Kt, Ld, Lq, pp, 50.0f));
+        for (float torque = -8.0f; torque <= 8.0f; torque += 0.37f) {
+            auto [id, iq] = table.get_current(torque);
+            CHECK(id <= 0.0f);
+            CHECK(torque_of(id, iq) == Approx(torque).epsilon(1e-4));
+        }
+        auto [id0, iq0] = table.get_current(0.0f);
+        CHECK(id0 == Approx(0.0f));
+        CHECK(iq0 == Approx(0.0f));
+    }
+
+    TEST_CASE("uses less current than Id = 0") {
+        MtpaTable table;
+        REQUIRE(table.generate(Kt, Ld, Lq, pp, 50.0f));
+        for (float torque: {1.0f, 3.0f, 5.0f}) {
+            auto [id, iq] = table.get_current(torque);
+            float is = std::sqrt(id * id + iq * iq);
+            CHECK(is < torque / Kt);
+
+            // Moving along the constant current circle in either direction loses torque
+            float angle = std::atan2(-id, iq);
+            for (float d: {-0.02f, 0.02f}) {
+                float t = torque_of(-is * std::sin(angle + d), is * std::cos(angle + d));
+                CHECK(t < torque_of(id, iq));
+            }
+        }
+    }
+
+    TEST_CASE("extrapolates above the table range") {
+        MtpaTable table;
+        REQUIRE(table.generate(Kt, Ld, Lq, pp, 10.0f));
+        auto [id_a, iq_a] = table.get_current(5.0f);
+        auto [id_b, iq_b] = table.get_current(-10.0f);
+        CHECK(id_a == Approx(id_b));
+        CHECK(torque_of(id_a, iq_a) == Approx(5.0f));
+        CHECK(torque_of(id_b, iq_b) == Approx(-10.0f));
+    }
+}
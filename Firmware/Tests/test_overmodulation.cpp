@@ -0,0 +1,61 @@
+#include <doctest.h>
+#include "MotorControl/overmodulation.hpp"
+
+#include <cmath>
+#include <initializer_list>
+
+using doctest::Approx;
+
+// Fundamental of the output over one electrical revolution of a vector with
+// magnitude m, and the largest distance of the output beyond the hexagon.
+static void run_revolution(float m, double* fundamental, double* hexagon_excess) {
+    constexpr int N = 3600;
+    double sum = 0.0;
+    double excess = -1.0;
+    for (int i = 0; i < N; ++i) {
+        double theta = 2.0 * M_PI * (i + 0.5) / N;
+        float alpha = m * (float)std::cos(theta);
+        float beta = m * (float)std::sin(theta);
+        overmodulation::apply(&alpha, &beta);
+        sum += alpha * std::cos(theta) + beta * std::sin(theta);
+        for (int k = 0; k < 6; ++k) {
+            double n = M_PI / 6.0 + k * M_PI / 3.0;
+            excess = std::fmax(excess, alpha * std::cos(n) + beta * std::sin(n) - overmodulation::LINEAR_LIMIT);
+        }
+    }
+    *fundamental = sum / N;
+    *hexagon_excess = excess;
+}
+
+TEST_SUITE("overmodulation") {
+    TEST_CASE("linear range is unchanged") {
+        float alpha = 0.5f;
+        float beta = -0.6f;
+        CHECK(!overmodulation::apply(&alpha, &beta));
+        CHECK(alpha == 0.5f);
+        CHECK(beta == -0.6f);
+    }
+
+    TEST_CASE("fundamental is preserved") {
+        for (float m: {0.87f, 0.88f, 0.895f, 0.905f, 0.91f, 0.92f, 0.93f, 0.94f, 0.95f}) {
+            double fundamental, excess;
+            run_revolution(m, &fundamental, &excess);
+            CAPTURE(m);
+            CHECK(fundamental == Approx(m).epsilon(0.003));
+            CHECK(excess < 1e-5);
+        }
+    }
+
+    TEST_CASE("six-step") {
+        double fundamental, excess;
+        run_revolution(1.0f, &fundamental, &excess);
+        CHECK(fundamental == Approx(overmodulation::SIX_STEP_LIMIT).epsilon(0.003));
+        CHECK(excess < 1e-5);
+
+        float alpha = 0.99f;
+        float beta = 0.2f;
+        overmodulation::apply(&alpha, &beta);
+        CHECK(alpha == Approx(1.0f));
+        CHECK(beta == Approx(0.0f).epsilon(1e-5));
+    }
+}
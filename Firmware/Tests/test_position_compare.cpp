@@ -0,0 +1,93 @@
+#include <doctest.h>
+#include "MotorControl/position_compare.hpp"
+
+using doctest::Approx;
+
+static size_t find_crossing(const PositionCompare::Config_t& config, float from, float to, float* crossed) {
+    SplitPosition split_crossed;
+    size_t count = PositionCompare::find_crossing(config, SplitPosition::from_float(from), SplitPosition::from_float(to), &split_crossed);
+    if (count > 0) {
+        *crossed = split_crossed.to_float();
+    }
+    return count;
+}
+
+TEST_SUITE("position_compare") {
+    TEST_CASE("interval") {
+        PositionCompare::Config_t config;
+        config.mode = PositionCompare::MODE_INTERVAL;
+        config.interval_start = 0.25f;
+        config.interval = 0.5f;
+        float crossed = 0.0f;
+
+        CHECK(find_crossing(config, 0.3f, 0.7f, &crossed) == 0);
+        CHECK(find_crossing(config, 0.7f, 0.8f, &crossed) == 1);
+        CHECK(crossed == Approx(0.75f));
+        CHECK(find_crossing(config, 0.8f, 0.7f, &crossed) == 1);
+        CHECK(crossed == Approx(0.75f));
+        CHECK(find_crossing(config, -1.0f, 0.3f, &crossed) == 3);
+        CHECK(crossed == Approx(0.25f));
+        CHECK(find_crossing(config, 0.3f, -1.0f, &crossed) == 3);
+        CHECK(crossed == Approx(-0.75f));
+    }
+
+    TEST_CASE("boundary is crossed once") {
+        PositionCompare::Config_t config;
+        config.interval = 1.0f;
+        float crossed = 0.0f;
+
+        CHECK(find_crossing(config, 0.9f, 1.0f, &crossed) == 1);
+        CHECK(find_crossing(config, 1.0f, 1.1f, &crossed) == 0);
+        CHECK(find_crossing(config, 1.1f, 1.0f, &crossed) == 0);
+        CHECK(find_crossing(config, 1.0f, 0.9f, &crossed) == 1);
+    }
+
+    TEST_CASE("list") {
+        PositionCompare::Config_t config;
+        config.mode = PositionCompare::MODE_LIST;
+        config.num_positions = 3;
+        config.positions[0] = 1.0f;
+        config.positions[1] = -2.0f;
+        config.positions[2] = 1.5f;
+        float crossed = 0.0f;
+
+        CHECK(find_crossing(config, 0.0f, 0.5f, &crossed) == 0);
+        CHECK(find_crossing(config, 0.0f, 2.0f, &crossed) == 2);
+        CHECK(crossed == Approx(1.5f));
+        CHECK(find_crossing(config, 2.0f, -3.0f, &crossed) == 3);
+        CHECK(crossed == Approx(-2.0f));
+        config.num_positions = 1;
+        CHECK(find_crossing(config, 2.0f, -3.0f, &crossed) == 1);
+        CHECK(crossed == Approx(1.0f));
+    }
+
+    TEST_CASE("far from zero") {
+        // At 1e6 turns a float only resolves 1/16 turn, the split position
+        // keeps the resolution of the fraction
+        PositionCompare::Config_t config;
+        config.interval = 1.0f / 1024.0f;  // exact in binary, so the grid does not drift
+        SplitPosition from{1000000, 0.0004f};
+        SplitPosition to{1000000, 0.0016f};
+        SplitPosition crossed;
+
+        CHECK(PositionCompare::find_crossing(config, from, to, &crossed) == 1);
+        CHECK(crossed.integer == 1000000);
+        CHECK(crossed.fraction == Approx(1.0f / 1024.0f));
+        CHECK(PositionCompare::find_crossing(config, to, from, &crossed) == 1);
+        CHECK(crossed.fraction == Approx(1.0f / 1024.0f));
+        CHECK(PositionCompare::find_crossing(config, from, from + 0.0005f, &crossed) == 0);
+
+        SplitPosition below{-1000001, 0.9996f};
+        CHECK(PositionCompare::find_crossing(config, below, below + 0.0008f, &crossed) == 1);
+        CHECK(crossed.integer == -1000000);
+        CHECK(crossed.fraction == Approx(0.0f));
+
+        config.mode = PositionCompare::MODE_LIST;
+        config.num_positions = 1;
+        config.positions[0] = 1000000.0f;
+        CHECK(PositionCompare::find_crossing(config, SplitPosition{999999, 0.9999f}, SplitPosition{1000000, 0.0001f}, &crossed) == 1);
+        CHECK(crossed.integer == 1000000);
+        CHECK(crossed.fraction == Approx(0.0f));
+        CHECK(PositionCompare::find_crossing(config, SplitPosition{1000000, 0.0001f}, SplitPosition{1000000, 0.0002f}, &crossed) == 0);
+    }
+}
@@ -0,0 +1,111 @@
+#include <doctest.h>
+#include "MotorControl/split_position.hpp"
+#include "MotorControl/encoder_pll.hpp"
+
+#include <cmath>
+
+using doctest::Approx;
+
+TEST_SUITE("split_position") {
+    TEST_CASE("conversion") {
+        SplitPosition p = SplitPosition::from_float(-2.25f);
+        CHECK(p.integer == -3);
+        CHECK(p.fraction == 0.75f);
+        CHECK(p.to_float() == -2.25f);
+
+        // Tiny negative values must not produce a fraction of 1.0
+        p = SplitPosition::from_float(-1e-9f);
+        CHECK(p.fraction >= 0.0f);
+        CHECK(p.fraction < 1.0f);
+    }
+
+    TEST_CASE("counts to turns") {
+        SplitPosition counts = {-8193, 0.5f};
+        SplitPosition turns = counts.to_turns(8192);
+        CHECK(turns.integer == -2);
+        CHECK(turns.fraction == Approx(8191.5f / 8192.0f));
+
+        counts = {8192 * 5000 + 1, 0.25f};
+        turns = counts.to_turns(8192);
+        CHECK(turns.integer == 5000);
+        CHECK(turns.fraction == Approx(1.25f / 8192.0f));
+    }
+
+    TEST_CASE("accumulation at large offset") {
+        // A float at 2^24 can't represent increments below 1; the split
+        // position integrates small steps at the same rate as near zero.
+        const float offset = 16777216.0f;
+        const float step = 1.0f / 8000.0f;
+        SplitPosition split = SplitPosition::from_float(offset);
+        float flt = offset;
+        for (int i = 0; i < 8000; ++i) {
+            split += step;
+            flt += step;
+        }
+        CHECK(flt == offset);  // the float did not move at all
+        CHECK(split - SplitPosition::from_float(offset) == Approx(1.0f).epsilon(1e-4));
+        CHECK(split.to_float() == offset + 1.0f);
+    }
+
+    TEST_CASE("differences at large offset") {
+        SplitPosition a = {100000000, 0.123f};
+        SplitPosition b = {99999999, 0.623f};
+        CHECK(a - b == Approx(0.5f));
+        CHECK(b - a == Approx(-0.5f));
+        CHECK((b + 0.5f).integer == a.integer);
+        CHECK((b + 0.5f) - a == Approx(0.0f));
+
+        // Tracking a count edge one count away from a large position
+        SplitPosition estimate = {2000000000, 0.999f};
+        estimate += 0.002f;
+        CHECK(estimate.integer == 2000000001);
+        CHECK(estimate.fraction == Approx(0.001f).epsilon(1e-3));
+    }
+
+    TEST_CASE("encoder pll at 1e6 turns") {
+        // Same loop as Encoder::update() for an incremental encoder. The run
+        // at 1e6 turns (2.048e9 counts, where float spacing is 256 counts)
+        // must behave exactly like the same run started at zero.
+        const int32_t cpr = 2048;
+        const double vel = 0.5 * cpr;  // [count/s]
+        const float dt = 1.0f / 8000.0f;
+        const float kp = 2000.0f;
+        const float ki = 0.25f * kp * kp;
+        auto floor_model = [](const SplitPosition& pos) { return pos.integer; };
+
+        struct Pll { SplitPosition pos; float vel; };
+        auto step = [&](Pll& pll, int32_t count) {
+            float delta = encoder_pll_update_linear(pll.pos, pll.vel, count, floor_model, kp, dt);
+            pll.vel += dt * ki * delta;
+        };
+
+        const int32_t far = 1000000 * cpr;
+        Pll near_pll = {{0, 0.0f}, 0.0f};
+        Pll far_pll = {{far, 0.0f}, 0.0f};
+        SplitPosition far_start = far_pll.pos;
+        float max_error = 0.0f;
+        float max_mismatch = 0.0f;
+        for (int i = 1; i <= 8000; ++i) {
+            double truth = vel * (double)i * (double)dt;
+            int32_t count = (int32_t)std::floor(truth);
+            step(near_pll, count);
+            step(far_pll, far + count);
+            max_mismatch = std::max(max_mismatch, std::abs((far_pll.pos - far_start) - near_pll.pos.to_float()));
+            if (i > 800) {  // allow 100ms to lock
+                max_error = std::max(max_error, std::abs(near_pll.pos.to_float() - (float)truth));
+            }
+        }
+
+        CHECK(max_error < 1.0f);
+        CHECK(max_mismatch < 1e-3f);
+        CHECK(far_pll.vel == near_pll.vel);
+        SplitPosition turns = far_pll.pos.to_turns(cpr);
+        CHECK(turns.integer == 1000000);
+        CHECK(turns.fraction == Approx(0.5f).epsilon(1.0f / cpr));
+
+        // The same predict step on a plain float does not move at all
+        float flt = (float)far;
+        flt += dt * far_pll.vel;
+        CHECK(flt == (float)far);
+    }
+}
@@ -200,6 +200,136 @@ static inline bool odrive_controller_get_anticogging_value(std::optional<ODriveI
     return ((out_val && ((*out_val = std::get<0>(ret)), true)) || fibre::Codec<float>::encode(std::get<0>(ret), output_buffer));
 }
 
+static inline bool odrive_controller_start_gain_identification(std::optional<ODriveIntf::ControllerIntf*> in_obj, bool* out_success, fibre::cbufptr_t* input_buffer, fibre::bufptr_t* output_buffer) {
+    bool success = (in_obj.has_value() || (in_obj = fibre::Codec<ODriveIntf::ControllerIntf*>::decode(input_buffer)).has_value());
+    if (!success) {
+        return false;
+    }
+    std::tuple<bool> ret = (*in_obj)->start_gain_identification();
+    return ((out_success && ((*out_success = std::get<0>(ret)), true)) || fibre::Codec<bool>::encode(std::get<0>(ret), output_buffer));
+}
+
+static inline bool odrive_controller_apply_identified_gains(std::optional<ODriveIntf::ControllerIntf*> in_obj, bool* out_success, fibre::cbufptr_t* input_buffer, fibre::bufptr_t* output_buffer) {
+    bool success = (in_obj.has_value() || (in_obj = fibre::Codec<ODriveIntf::ControllerIntf*>::decode(input_buffer)).has_value());
+    if (!success) {
+        return false;
+    }
+    std::tuple<bool> ret = (*in_obj)->apply_identified_gains();
+    return ((out_success && ((*out_success = std::get<0>(ret)), true)) || fibre::Codec<bool>::encode(std::get<0>(ret), output_buffer));
+}
+
+static inline bool odrive_controller_start_frequency_response(std::optional<ODriveIntf::ControllerIntf*> in_obj, bool* out_success, fibre::cbufptr_t* input_buffer, fibre::bufptr_t* output_buffer) {
+    bool success = (in_obj.has_value() || (in_obj = fibre::Codec<ODriveIntf::ControllerIntf*>::decode(input_buffer)).has_value());
+    if (!success) {
+        return false;
+    }
+    std::tuple<bool> ret = (*in_obj)->start_frequency_response();
+    return ((out_success && ((*out_success = std::get<0>(ret)), true)) || fibre::Codec<bool>::encode(std::get<0>(ret), output_buffer));
+}
+
+static inline bool odrive_controller_get_frequency_response_point(std::optional<ODriveIntf::ControllerIntf*> in_obj, std::optional<uint32_t> in_index, float* out_frequency, float* out_gain, float* out_phase, fibre::cbufptr_t* input_buffer, fibre::bufptr_t* output_buffer) {
+    bool success = (in_obj.has_value() || (in_obj = fibre::Codec<ODriveIntf::ControllerIntf*>::decode(input_buffer)).has_value())
+                && (in_index.has_value() || (in_index = fibre::Codec<uint32_t>::decode(input_buffer)).has_value());
+    if (!success) {
+        return false;
+    }
+    std::tuple<float, float, float> ret = (*in_obj)->get_frequency_response_point(*in_index);
+    return ((out_frequency && ((*out_frequency = std::get<0>(ret)), true)) || fibre::Codec<float>::encode(std::get<0>(ret), output_buffer))
+        && ((out_gain && ((*out_gain = std::get<1>(ret)), true)) || fibre::Codec<float>::encode(std::get<1>(ret), output_buffer))
+        && ((out_phase && ((*out_phase = std::get<2>(ret)), true)) || fibre::Codec<float>::encode(std::get<2>(ret), output_buffer));
+}
+
+static inline bool odrive_controller_start_friction_calibration(std::optional<ODriveIntf::ControllerIntf*> in_obj, bool* out_success, fibre::cbufptr_t* input_buffer, fibre::bufptr_t* output_buffer) {
+    bool success = (in_obj.has_value() || (in_obj = fibre::Codec<ODriveIntf::ControllerIntf*>::decode(input_buffer)).has_value());
+    if (!success) {
+        return false;
+    }
+    std::tuple<bool> ret = (*in_obj)->start_friction_calibration();
+    return ((out_success && ((*out_success = std::get<0>(ret)), true)) || fibre::Codec<bool>::encode(std::get<0>(ret), output_buffer));
+}
+
+static inline bool odrive_controller_get_friction_calibration_point(std::optional<ODriveIntf::ControllerIntf*> in_obj, std::optional<uint32_t> in_index, float* out_vel, float* out_torque, fibre::cbufptr_t* input_buffer, fibre::bufptr_t* output_buffer) {
+    bool success = (in_obj.has_value() || (in_obj = fibre::Codec<ODriveIntf::ControllerIntf*>::decode(input_buffer)).has_value())
+                && (in_index.has_value() || (in_index = fibre::Codec<uint32_t>::decode(input_buffer)).has_value());
+    if (!success) {
+        return false;
+    }
+    std::tuple<float, float> ret = (*in_obj)->get_friction_calibration_point(*in_index);
+    return ((out_vel && ((*out_vel = std::get<0>(ret)), true)) || fibre::Codec<float>::encode(std::get<0>(ret), output_buffer))
+        && ((out_torque && ((*out_torque = std::get<1>(ret)), true)) || fibre::Codec<float>::encode(std::get<1>(ret), output_buffer));
+}
+
+static inline bool odrive_controller_set_pos_gain_table_point(std::optional<ODriveIntf::ControllerIntf*> in_obj, std::optional<uint32_t> in_index, std::optional<float> in_pos_gain, std::optional<float> in_vel_gain, std::optional<float> in_vel_integrator_gain, bool* out_success, fibre::cbufptr_t* input_buffer, fibre::bufptr_t* output_buffer) {
+    bool success = (in_obj.has_value() || (in_obj = fibre::Codec<ODriveIntf::ControllerIntf*>::decode(input_buffer)).has_value())
+                && (in_index.has_value() || (in_index = fibre::Codec<uint32_t>::decode(input_buffer)).has_value())
+                && (in_pos_gain.has_value() || (in_pos_gain = fibre::Codec<float>::decode(input_buffer)).has_value())
+                && (in_vel_gain.has_value() || (in_vel_gain = fibre::Codec<float>::decode(input_buffer)).has_value())
+                && (in_vel_integrator_gain.has_value() || (in_vel_integrator_gain = fibre::Codec<float>::decode(input_buffer)).has_value());
+    if (!success) {
+        return false;
+    }
+    std::tuple<bool> ret = (*in_obj)->set_pos_gain_table_point(*in_index, *in_pos_gain, *in_vel_gain, *in_vel_integrator_gain);
+    return ((out_success && ((*out_success = std::get<0>(ret)), true)) || fibre::Codec<bool>::encode(std::get<0>(ret), output_buffer));
+}
+
+static inline bool odrive_controller_get_pos_gain_table_point(std::optional<ODriveIntf::ControllerIntf*> in_obj, std::optional<uint32_t> in_index, float* out_pos_gain, float* out_vel_gain, float* out_vel_integrator_gain, fibre::cbufptr_t* input_buffer, fibre::bufptr_t* output_buffer) {
+    bool success = (in_obj.has_value() || (in_obj = fibre::Codec<ODriveIntf::ControllerIntf*>::decode(input_buffer)).has_value())
+                && (in_index.has_value() || (in_index = fibre::Codec<uint32_t>::decode(input_buffer)).has_value());
+    if (!success) {
+        return false;
+    }
+    std::tuple<float, float, float> ret = (*in_obj)->get_pos_gain_table_point(*in_index);
+    return ((out_pos_gain && ((*out_pos_gain = std::get<0>(ret)), true)) || fibre::Codec<float>::encode(std::get<0>(ret), output_buffer))
+        && ((out_vel_gain && ((*out_vel_gain = std::get<1>(ret)), true)) || fibre::Codec<float>::encode(std::get<1>(ret), output_buffer))
+        && ((out_vel_integrator_gain && ((*out_vel_integrator_gain = std::get<2>(ret)), true)) || fibre::Codec<float>::encode(std::get<2>(ret), output_buffer));
+}
+
+static inline bool odrive_controller_set_vel_gain_table_point(std::optional<ODriveIntf::ControllerIntf*> in_obj, std::optional<uint32_t> in_index, std::optional<float> in_pos_gain, std::optional<float> in_vel_gain, std::optional<float> in_vel_integrator_gain, bool* out_success, fibre::cbufptr_t* input_buffer, fibre::bufptr_t* output_buffer) {
+    bool success = (in_obj.has_value() || (in_obj = fibre::Codec<ODriveIntf::ControllerIntf*>::decode(input_buffer)).has_value())
+                && (in_index.has_value() || (in_index = fibre::Codec<uint32_t>::decode(input_buffer)).has_value())
+                && (in_pos_gain.has_value() || (in_pos_gain = fibre::Codec<float>::decode(input_buffer)).has_value())
+                && (in_vel_gain.has_value() || (in_vel_gain = fibre::Codec<float>::decode(input_buffer)).has_value())
+                && (in_vel_integrator_gain.has_value() || (in_vel_integrator_gain = fibre::Codec<float>::decode(input_buffer)).has_value());
+    if (!success) {
+        return false;
+    }
+    std::tuple<bool> ret = (*in_obj)->set_vel_gain_table_point(*in_index, *in_pos_gain, *in_vel_gain, *in_vel_integrator_gain);
+    return ((out_success && ((*out_success = std::get<0>(ret)), true)) || fibre::Codec<bool>::encode(std::get<0>(ret), output_buffer));
+}
+
+static inline bool odrive_controller_get_vel_gain_table_point(std::optional<ODriveIntf::ControllerIntf*> in_obj, std::optional<uint32_t> in_index, float* out_pos_gain, float* out_vel_gain, float* out_vel_integrator_gain, fibre::cbufptr_t* input_buffer, fibre::bufptr_t* output_buffer) {
+    bool success = (in_obj.has_value() || (in_obj = fibre::Codec<ODriveIntf::ControllerIntf*>::decode(input_buffer)).has_value())
+                && (in_index.has_value() || (in_index = fibre::Codec<uint32_t>::decode(input_buffer)).has_value());
+    if (!success) {
+        return false;
+    }
+    std::tuple<float, float, float> ret = (*in_obj)->get_vel_gain_table_point(*in_index);
+    return ((out_pos_gain && ((*out_pos_gain = std::get<0>(ret)), true)) || fibre::Codec<float>::encode(std::get<0>(ret), output_buffer))
+        && ((out_vel_gain && ((*out_vel_gain = std::get<1>(ret)), true)) || fibre::Codec<float>::encode(std::get<1>(ret), output_buffer))
+        && ((out_vel_integrator_gain && ((*out_vel_integrator_gain = std::get<2>(ret)), true)) || fibre::Codec<float>::encode(std::get<2>(ret), output_buffer));
+}
+
+static inline bool odrive_controller_set_cam_point(std::optional<ODriveIntf::ControllerIntf*> in_obj, std::optional<uint32_t> in_index, std::optional<float> in_pos, bool* out_success, fibre::cbufptr_t* input_buffer, fibre::bufptr_t* output_buffer) {
+    bool success = (in_obj.has_value() || (in_obj = fibre::Codec<ODriveIntf::ControllerIntf*>::decode(input_buffer)).has_value())
+                && (in_index.has_value() || (in_index = fibre::Codec<uint32_t>::decode(input_buffer)).has_value())
+                && (in_pos.has_value() || (in_pos = fibre::Codec<float>::decode(input_buffer)).has_value());
+    if (!success) {
+        return false;
+    }
+    std::tuple<bool> ret = (*in_obj)->set_cam_point(*in_index, *in_pos);
+    return ((out_success && ((*out_success = std::get<0>(ret)), true)) || fibre::Codec<bool>::encode(std::get<0>(ret), output_buffer));
+}
+
+static inline bool odrive_controller_get_cam_point(std::optional<ODriveIntf::ControllerIntf*> in_obj, std::optional<uint32_t> in_index, float* out_pos, fibre::cbufptr_t* input_buffer, fibre::bufptr_t* output_buffer) {
+    bool success = (in_obj.has_value() || (in_obj = fibre::Codec<ODriveIntf::ControllerIntf*>::decode(input_buffer)).has_value())
+                && (in_index.has_value() || (in_index = fibre::Codec<uint32_t>::decode(input_buffer)).has_value());
+    if (!success) {
+        return false;
+    }
+    std::tuple<float> ret = (*in_obj)->get_cam_point(*in_index);
+    return ((out_pos && ((*out_pos = std::get<0>(ret)), true)) || fibre::Codec<float>::encode(std::get<0>(ret), output_buffer));
+}
+
 
 
 static inline bool odrive_encoder_set_linear_count(std::optional<ODriveIntf::EncoderIntf*> in_obj, std::optional<int32_t> in_count, fibre::cbufptr_t* input_buffer, fibre::bufptr_t* output_buffer) {
@@ -217,6 +347,14 @@ static inline bool odrive_encoder_set_linear_count(std::optional<ODriveIntf::Enc
 
 
 
+static inline bool odrive_endstop_arm_latch(std::optional<ODriveIntf::EndstopIntf*> in_obj, fibre::cbufptr_t* input_buffer, fibre::bufptr_t* output_buffer) {
+    bool success = (in_obj.has_value() || (in_obj = fibre::Codec<ODriveIntf::EndstopIntf*>::decode(input_buffer)).has_value());
+    if (!success) {
+        return false;
+    }
+    (*in_obj)->arm_latch();
+    return true;
+}
 
 
 
@@ -28,6 +28,28 @@ class ODriveIntf {
 public:
     class ConfigIntf {
     public:
+        class KinematicsIntf {
+        public:
+            template<typename T> static inline auto get_type(T* obj) { return Property<uint8_t>{obj, [](void* ctx){ return (uint8_t)((T*)ctx)->type; }, [](void* ctx, uint8_t value){ ((T*)ctx)->set_type(value); }}; }
+            template<typename T> static inline void get_type(T* obj, void* ptr) { new (ptr) Property<uint8_t>{obj, [](void* ctx){ return (uint8_t)((T*)ctx)->type; }, [](void* ctx, uint8_t value){ ((T*)ctx)->set_type(value); }}; }
+            template<typename T> static inline auto get_scale(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->scale; }, [](void* ctx, float value){ ((T*)ctx)->set_scale(value); }}; }
+            template<typename T> static inline void get_scale(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->scale; }, [](void* ctx, float value){ ((T*)ctx)->set_scale(value); }}; }
+            template<typename T> static inline auto get_matrix0(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->matrix[0]; }, [](void* ctx, float value){ ((T*)ctx)->set_matrix0(value); }}; }
+            template<typename T> static inline void get_matrix0(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->matrix[0]; }, [](void* ctx, float value){ ((T*)ctx)->set_matrix0(value); }}; }
+            template<typename T> static inline auto get_matrix1(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->matrix[1]; }, [](void* ctx, float value){ ((T*)ctx)->set_matrix1(value); }}; }
+            template<typename T> static inline void get_matrix1(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->matrix[1]; }, [](void* ctx, float value){ ((T*)ctx)->set_matrix1(value); }}; }
+            template<typename T> static inline auto get_matrix2(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->matrix[2]; }, [](void* ctx, float value){ ((T*)ctx)->set_matrix2(value); }}; }
+            template<typename T> static inline void get_matrix2(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->matrix[2]; }, [](void* ctx, float value){ ((T*)ctx)->set_matrix2(value); }}; }
+            template<typename T> static inline auto get_matrix3(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->matrix[3]; }, [](void* ctx, float value){ ((T*)ctx)->set_matrix3(value); }}; }
+            template<typename T> static inline void get_matrix3(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->matrix[3]; }, [](void* ctx, float value){ ((T*)ctx)->set_matrix3(value); }}; }
+        };
+        class MotionQueueIntf {
+        public:
+            template<typename T> static inline auto get_accel_limit(T* obj) { return Property<float>{&obj->accel_limit}; }
+            template<typename T> static inline void get_accel_limit(T* obj, void* ptr) { new (ptr) Property<float>{&obj->accel_limit}; }
+            template<typename T> static inline auto get_rapid_rate(T* obj) { return Property<float>{&obj->rapid_rate}; }
+            template<typename T> static inline void get_rapid_rate(T* obj, void* ptr) { new (ptr) Property<float>{&obj->rapid_rate}; }
+        };
         template<typename T> static inline auto get_enable_uart_a(T* obj) { return Property<bool>{&obj->enable_uart_a}; }
         template<typename T> static inline void get_enable_uart_a(T* obj, void* ptr) { new (ptr) Property<bool>{&obj->enable_uart_a}; }
         template<typename T> static inline auto get_enable_uart_b(T* obj) { return Property<bool>{&obj->enable_uart_b}; }
@@ -76,6 +98,10 @@ public:
         template<typename T> static inline void get_error_gpio_pin(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->error_gpio_pin}; }
         template<typename T> static inline auto get_gpio3_analog_mapping(T* obj) { return &obj->analog_mappings[3]; }
         template<typename T> static inline auto get_gpio4_analog_mapping(T* obj) { return &obj->analog_mappings[4]; }
+        template<typename T> static inline auto get_kinematics(T* obj) { return &obj->kinematics; }
+        template<typename T> static inline auto get_motion_queue(T* obj) { return &obj->motion_queue; }
+        template<typename T> static inline auto get_enable_double_pwm_update(T* obj) { return Property<bool>{&obj->enable_double_pwm_update}; }
+        template<typename T> static inline void get_enable_double_pwm_update(T* obj, void* ptr) { new (ptr) Property<bool>{&obj->enable_double_pwm_update}; }
     };
     class CanIntf {
     public:
@@ -269,7 +295,9 @@ public:
         template<typename T> static inline auto get_trap_traj(T* obj) { return &obj->trap_traj_; }
         template<typename T> static inline auto get_min_endstop(T* obj) { return &obj->min_endstop_; }
         template<typename T> static inline auto get_max_endstop(T* obj) { return &obj->max_endstop_; }
+        template<typename T> static inline auto get_probe(T* obj) { return &obj->probe_; }
         template<typename T> static inline auto get_mechanical_brake(T* obj) { return &obj->mechanical_brake_; }
+        template<typename T> static inline auto get_position_compare(T* obj) { return &obj->position_compare_; }
         template<typename T> static inline auto get_task_times(T* obj) { return &obj->task_times_; }
         virtual void watchdog_feed() = 0;
     };
@@ -361,18 +389,20 @@ public:
         public:
             template<typename T> static inline auto get_pre_calibrated(T* obj) { return Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->pre_calibrated; }, [](void* ctx, bool value){ ((T*)ctx)->set_pre_calibrated(value); }}; }
             template<typename T> static inline void get_pre_calibrated(T* obj, void* ptr) { new (ptr) Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->pre_calibrated; }, [](void* ctx, bool value){ ((T*)ctx)->set_pre_calibrated(value); }}; }
-            template<typename T> static inline auto get_pole_pairs(T* obj) { return Property<int32_t>{&obj->pole_pairs}; }
-            template<typename T> static inline void get_pole_pairs(T* obj, void* ptr) { new (ptr) Property<int32_t>{&obj->pole_pairs}; }
+            template<typename T> static inline auto get_pole_pairs(T* obj) { return Property<int32_t>{obj, [](void* ctx){ return (int32_t)((T*)ctx)->pole_pairs; }, [](void* ctx, int32_t value){ ((T*)ctx)->set_pole_pairs(value); }}; }
+            template<typename T> static inline void get_pole_pairs(T* obj, void* ptr) { new (ptr) Property<int32_t>{obj, [](void* ctx){ return (int32_t)((T*)ctx)->pole_pairs; }, [](void* ctx, int32_t value){ ((T*)ctx)->set_pole_pairs(value); }}; }
             template<typename T> static inline auto get_calibration_current(T* obj) { return Property<float>{&obj->calibration_current}; }
             template<typename T> static inline void get_calibration_current(T* obj, void* ptr) { new (ptr) Property<float>{&obj->calibration_current}; }
             template<typename T> static inline auto get_resistance_calib_max_voltage(T* obj) { return Property<float>{&obj->resistance_calib_max_voltage}; }
             template<typename T> static inline void get_resistance_calib_max_voltage(T* obj, void* ptr) { new (ptr) Property<float>{&obj->resistance_calib_max_voltage}; }
+            template<typename T> static inline auto get_calibration_tolerance(T* obj) { return Property<float>{&obj->calibration_tolerance}; }
+            template<typename T> static inline void get_calibration_tolerance(T* obj, void* ptr) { new (ptr) Property<float>{&obj->calibration_tolerance}; }
             template<typename T> static inline auto get_phase_inductance(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->phase_inductance; }, [](void* ctx, float value){ ((T*)ctx)->set_phase_inductance(value); }}; }
             template<typename T> static inline void get_phase_inductance(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->phase_inductance; }, [](void* ctx, float value){ ((T*)ctx)->set_phase_inductance(value); }}; }
             template<typename T> static inline auto get_phase_resistance(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->phase_resistance; }, [](void* ctx, float value){ ((T*)ctx)->set_phase_resistance(value); }}; }
             template<typename T> static inline void get_phase_resistance(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->phase_resistance; }, [](void* ctx, float value){ ((T*)ctx)->set_phase_resistance(value); }}; }
-            template<typename T> static inline auto get_torque_constant(T* obj) { return Property<float>{&obj->torque_constant}; }
-            template<typename T> static inline void get_torque_constant(T* obj, void* ptr) { new (ptr) Property<float>{&obj->torque_constant}; }
+            template<typename T> static inline auto get_torque_constant(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->torque_constant; }, [](void* ctx, float value){ ((T*)ctx)->set_torque_constant(value); }}; }
+            template<typename T> static inline void get_torque_constant(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->torque_constant; }, [](void* ctx, float value){ ((T*)ctx)->set_torque_constant(value); }}; }
             template<typename T> static inline auto get_motor_type(T* obj) { return Property<ODriveIntf::MotorIntf::MotorType>{&obj->motor_type}; }
             template<typename T> static inline void get_motor_type(T* obj, void* ptr) { new (ptr) Property<ODriveIntf::MotorIntf::MotorType>{&obj->motor_type}; }
             template<typename T> static inline auto get_current_lim(T* obj) { return Property<float>{&obj->current_lim}; }
@@ -411,6 +441,38 @@ public:
             template<typename T> static inline void get_I_leak_max(T* obj, void* ptr) { new (ptr) Property<float>{&obj->I_leak_max}; }
             template<typename T> static inline auto get_dc_calib_tau(T* obj) { return Property<float>{&obj->dc_calib_tau}; }
             template<typename T> static inline void get_dc_calib_tau(T* obj, void* ptr) { new (ptr) Property<float>{&obj->dc_calib_tau}; }
+            template<typename T> static inline auto get_max_modulation(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->max_modulation; }, [](void* ctx, float value){ ((T*)ctx)->set_max_modulation(value); }}; }
+            template<typename T> static inline void get_max_modulation(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->max_modulation; }, [](void* ctx, float value){ ((T*)ctx)->set_max_modulation(value); }}; }
+            template<typename T> static inline auto get_enable_overmodulation(T* obj) { return Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enable_overmodulation; }, [](void* ctx, bool value){ ((T*)ctx)->set_enable_overmodulation(value); }}; }
+            template<typename T> static inline void get_enable_overmodulation(T* obj, void* ptr) { new (ptr) Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enable_overmodulation; }, [](void* ctx, bool value){ ((T*)ctx)->set_enable_overmodulation(value); }}; }
+            template<typename T> static inline auto get_enable_field_weakening(T* obj) { return Property<bool>{&obj->enable_field_weakening}; }
+            template<typename T> static inline void get_enable_field_weakening(T* obj, void* ptr) { new (ptr) Property<bool>{&obj->enable_field_weakening}; }
+            template<typename T> static inline auto get_field_weakening_modulation(T* obj) { return Property<float>{&obj->field_weakening_modulation}; }
+            template<typename T> static inline void get_field_weakening_modulation(T* obj, void* ptr) { new (ptr) Property<float>{&obj->field_weakening_modulation}; }
+            template<typename T> static inline auto get_field_weakening_gain(T* obj) { return Property<float>{&obj->field_weakening_gain}; }
+            template<typename T> static inline void get_field_weakening_gain(T* obj, void* ptr) { new (ptr) Property<float>{&obj->field_weakening_gain}; }
+            template<typename T> static inline auto get_field_weakening_max_current(T* obj) { return Property<float>{&obj->field_weakening_max_current}; }
+            template<typename T> static inline void get_field_weakening_max_current(T* obj, void* ptr) { new (ptr) Property<float>{&obj->field_weakening_max_current}; }
+            template<typename T> static inline auto get_enable_mtpa(T* obj) { return Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enable_mtpa; }, [](void* ctx, bool value){ ((T*)ctx)->set_enable_mtpa(value); }}; }
+            template<typename T> static inline void get_enable_mtpa(T* obj, void* ptr) { new (ptr) Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enable_mtpa; }, [](void* ctx, bool value){ ((T*)ctx)->set_enable_mtpa(value); }}; }
+            template<typename T> static inline auto get_phase_inductance_d(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->phase_inductance_d; }, [](void* ctx, float value){ ((T*)ctx)->set_phase_inductance_d(value); }}; }
+            template<typename T> static inline void get_phase_inductance_d(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->phase_inductance_d; }, [](void* ctx, float value){ ((T*)ctx)->set_phase_inductance_d(value); }}; }
+            template<typename T> static inline auto get_phase_inductance_q(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->phase_inductance_q; }, [](void* ctx, float value){ ((T*)ctx)->set_phase_inductance_q(value); }}; }
+            template<typename T> static inline void get_phase_inductance_q(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->phase_inductance_q; }, [](void* ctx, float value){ ((T*)ctx)->set_phase_inductance_q(value); }}; }
+            template<typename T> static inline auto get_enable_complex_vector_current_control(T* obj) { return Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enable_complex_vector_current_control; }, [](void* ctx, bool value){ ((T*)ctx)->set_enable_complex_vector_current_control(value); }}; }
+            template<typename T> static inline void get_enable_complex_vector_current_control(T* obj, void* ptr) { new (ptr) Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enable_complex_vector_current_control; }, [](void* ctx, bool value){ ((T*)ctx)->set_enable_complex_vector_current_control(value); }}; }
+            template<typename T> static inline auto get_enable_dead_time_comp(T* obj) { return Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enable_dead_time_comp; }, [](void* ctx, bool value){ ((T*)ctx)->set_enable_dead_time_comp(value); }}; }
+            template<typename T> static inline void get_enable_dead_time_comp(T* obj, void* ptr) { new (ptr) Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enable_dead_time_comp; }, [](void* ctx, bool value){ ((T*)ctx)->set_enable_dead_time_comp(value); }}; }
+            template<typename T> static inline auto get_dead_time_comp_time(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->dead_time_comp_time; }, [](void* ctx, float value){ ((T*)ctx)->set_dead_time_comp_time(value); }}; }
+            template<typename T> static inline void get_dead_time_comp_time(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->dead_time_comp_time; }, [](void* ctx, float value){ ((T*)ctx)->set_dead_time_comp_time(value); }}; }
+            template<typename T> static inline auto get_dead_time_comp_voltage(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->dead_time_comp_voltage; }, [](void* ctx, float value){ ((T*)ctx)->set_dead_time_comp_voltage(value); }}; }
+            template<typename T> static inline void get_dead_time_comp_voltage(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->dead_time_comp_voltage; }, [](void* ctx, float value){ ((T*)ctx)->set_dead_time_comp_voltage(value); }}; }
+            template<typename T> static inline auto get_dead_time_comp_current_band(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->dead_time_comp_current_band; }, [](void* ctx, float value){ ((T*)ctx)->set_dead_time_comp_current_band(value); }}; }
+            template<typename T> static inline void get_dead_time_comp_current_band(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->dead_time_comp_current_band; }, [](void* ctx, float value){ ((T*)ctx)->set_dead_time_comp_current_band(value); }}; }
+            template<typename T> static inline auto get_enable_deadbeat_current_control(T* obj) { return Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enable_deadbeat_current_control; }, [](void* ctx, bool value){ ((T*)ctx)->set_enable_deadbeat_current_control(value); }}; }
+            template<typename T> static inline void get_enable_deadbeat_current_control(T* obj, void* ptr) { new (ptr) Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enable_deadbeat_current_control; }, [](void* ctx, bool value){ ((T*)ctx)->set_enable_deadbeat_current_control(value); }}; }
+            template<typename T> static inline auto get_deadbeat_gain(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->deadbeat_gain; }, [](void* ctx, float value){ ((T*)ctx)->set_deadbeat_gain(value); }}; }
+            template<typename T> static inline void get_deadbeat_gain(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->deadbeat_gain; }, [](void* ctx, float value){ ((T*)ctx)->set_deadbeat_gain(value); }}; }
         };
         enum Error {
             ERROR_NONE                       = 0x00000000,
@@ -473,6 +535,8 @@ public:
         template<typename T> static inline void get_phase_current_rev_gain(T* obj, void* ptr) { new (ptr) Property<float>{&obj->phase_current_rev_gain_}; }
         template<typename T> static inline auto get_effective_current_lim(T* obj) { return Property<const float>{&obj->effective_current_lim_}; }
         template<typename T> static inline void get_effective_current_lim(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->effective_current_lim_}; }
+        template<typename T> static inline auto get_field_weakening_id(T* obj) { return Property<const float>{&obj->field_weakening_id_}; }
+        template<typename T> static inline void get_field_weakening_id(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->field_weakening_id_}; }
         template<typename T> static inline auto get_max_allowed_current(T* obj) { return Property<const float>{&obj->max_allowed_current_}; }
         template<typename T> static inline void get_max_allowed_current(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->max_allowed_current_}; }
         template<typename T> static inline auto get_max_dc_calib(T* obj) { return Property<const float>{&obj->max_dc_calib_}; }
@@ -538,6 +602,23 @@ public:
                 template<typename T> static inline auto get_anticogging_enabled(T* obj) { return Property<bool>{&obj->anticogging_enabled}; }
                 template<typename T> static inline void get_anticogging_enabled(T* obj, void* ptr) { new (ptr) Property<bool>{&obj->anticogging_enabled}; }
             };
+            class CamIntf {
+            public:
+                template<typename T> static inline auto get_enabled(T* obj) { return Property<bool>{&obj->enabled}; }
+                template<typename T> static inline void get_enabled(T* obj, void* ptr) { new (ptr) Property<bool>{&obj->enabled}; }
+                template<typename T> static inline auto get_master_source(T* obj) { return Property<uint8_t>{&obj->master_source}; }
+                template<typename T> static inline void get_master_source(T* obj, void* ptr) { new (ptr) Property<uint8_t>{&obj->master_source}; }
+                template<typename T> static inline auto get_master_offset(T* obj) { return Property<float>{&obj->master_offset}; }
+                template<typename T> static inline void get_master_offset(T* obj, void* ptr) { new (ptr) Property<float>{&obj->master_offset}; }
+                template<typename T> static inline auto get_master_period(T* obj) { return Property<float>{&obj->master_period}; }
+                template<typename T> static inline void get_master_period(T* obj, void* ptr) { new (ptr) Property<float>{&obj->master_period}; }
+                template<typename T> static inline auto get_rise(T* obj) { return Property<float>{&obj->rise}; }
+                template<typename T> static inline void get_rise(T* obj, void* ptr) { new (ptr) Property<float>{&obj->rise}; }
+                template<typename T> static inline auto get_num_points(T* obj) { return Property<uint32_t>{&obj->num_points}; }
+                template<typename T> static inline void get_num_points(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->num_points}; }
+                template<typename T> static inline auto get_master_timeout(T* obj) { return Property<float>{&obj->master_timeout}; }
+                template<typename T> static inline void get_master_timeout(T* obj, void* ptr) { new (ptr) Property<float>{&obj->master_timeout}; }
+            };
             template<typename T> static inline auto get_gain_scheduling_width(T* obj) { return Property<float>{&obj->gain_scheduling_width}; }
             template<typename T> static inline void get_gain_scheduling_width(T* obj, void* ptr) { new (ptr) Property<float>{&obj->gain_scheduling_width}; }
             template<typename T> static inline auto get_enable_vel_limit(T* obj) { return Property<bool>{&obj->enable_vel_limit}; }
@@ -576,6 +657,10 @@ public:
             template<typename T> static inline void get_steps_per_circular_range(T* obj, void* ptr) { new (ptr) Property<int32_t>{obj, [](void* ctx){ return (int32_t)((T*)ctx)->steps_per_circular_range; }, [](void* ctx, int32_t value){ ((T*)ctx)->set_steps_per_circular_range(value); }}; }
             template<typename T> static inline auto get_homing_speed(T* obj) { return Property<float>{&obj->homing_speed}; }
             template<typename T> static inline void get_homing_speed(T* obj, void* ptr) { new (ptr) Property<float>{&obj->homing_speed}; }
+            template<typename T> static inline auto get_homing_fast_speed(T* obj) { return Property<float>{&obj->homing_fast_speed}; }
+            template<typename T> static inline void get_homing_fast_speed(T* obj, void* ptr) { new (ptr) Property<float>{&obj->homing_fast_speed}; }
+            template<typename T> static inline auto get_homing_backoff_distance(T* obj) { return Property<float>{&obj->homing_backoff_distance}; }
+            template<typename T> static inline void get_homing_backoff_distance(T* obj, void* ptr) { new (ptr) Property<float>{&obj->homing_backoff_distance}; }
             template<typename T> static inline auto get_inertia(T* obj) { return Property<float>{&obj->inertia}; }
             template<typename T> static inline void get_inertia(T* obj, void* ptr) { new (ptr) Property<float>{&obj->inertia}; }
             template<typename T> static inline auto get_axis_to_mirror(T* obj) { return Property<uint8_t>{&obj->axis_to_mirror}; }
@@ -584,6 +669,7 @@ public:
             template<typename T> static inline void get_mirror_ratio(T* obj, void* ptr) { new (ptr) Property<float>{&obj->mirror_ratio}; }
             template<typename T> static inline auto get_torque_mirror_ratio(T* obj) { return Property<float>{&obj->torque_mirror_ratio}; }
             template<typename T> static inline void get_torque_mirror_ratio(T* obj, void* ptr) { new (ptr) Property<float>{&obj->torque_mirror_ratio}; }
+            template<typename T> static inline auto get_cam(T* obj) { return &obj->cam; }
             template<typename T> static inline auto get_load_encoder_axis(T* obj) { return Property<uint8_t>{&obj->load_encoder_axis}; }
             template<typename T> static inline void get_load_encoder_axis(T* obj, void* ptr) { new (ptr) Property<uint8_t>{&obj->load_encoder_axis}; }
             template<typename T> static inline auto get_input_filter_bandwidth(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->input_filter_bandwidth; }, [](void* ctx, float value){ ((T*)ctx)->set_input_filter_bandwidth(value); }}; }
@@ -597,6 +683,36 @@ public:
             template<typename T> static inline void get_spinout_mechanical_power_threshold(T* obj, void* ptr) { new (ptr) Property<float>{&obj->spinout_mechanical_power_threshold}; }
             template<typename T> static inline auto get_spinout_electrical_power_threshold(T* obj) { return Property<float>{&obj->spinout_electrical_power_threshold}; }
             template<typename T> static inline void get_spinout_electrical_power_threshold(T* obj, void* ptr) { new (ptr) Property<float>{&obj->spinout_electrical_power_threshold}; }
+            template<typename T> static inline auto get_vel_filter0(T* obj) { return &obj->vel_filters[0]; }
+            template<typename T> static inline auto get_vel_filter1(T* obj) { return &obj->vel_filters[1]; }
+            template<typename T> static inline auto get_vel_filter2(T* obj) { return &obj->vel_filters[2]; }
+            template<typename T> static inline auto get_vel_filter3(T* obj) { return &obj->vel_filters[3]; }
+            template<typename T> static inline auto get_vel_filters_on_torque(T* obj) { return Property<bool>{&obj->vel_filters_on_torque}; }
+            template<typename T> static inline void get_vel_filters_on_torque(T* obj, void* ptr) { new (ptr) Property<bool>{&obj->vel_filters_on_torque}; }
+            template<typename T> static inline auto get_input_shaper_type(T* obj) { return Property<uint8_t>{obj, [](void* ctx){ return (uint8_t)((T*)ctx)->input_shaper_type; }, [](void* ctx, uint8_t value){ ((T*)ctx)->set_input_shaper_type(value); }}; }
+            template<typename T> static inline void get_input_shaper_type(T* obj, void* ptr) { new (ptr) Property<uint8_t>{obj, [](void* ctx){ return (uint8_t)((T*)ctx)->input_shaper_type; }, [](void* ctx, uint8_t value){ ((T*)ctx)->set_input_shaper_type(value); }}; }
+            template<typename T> static inline auto get_input_shaper_frequency(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->input_shaper_frequency; }, [](void* ctx, float value){ ((T*)ctx)->set_input_shaper_frequency(value); }}; }
+            template<typename T> static inline void get_input_shaper_frequency(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->input_shaper_frequency; }, [](void* ctx, float value){ ((T*)ctx)->set_input_shaper_frequency(value); }}; }
+            template<typename T> static inline auto get_input_shaper_damping(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->input_shaper_damping; }, [](void* ctx, float value){ ((T*)ctx)->set_input_shaper_damping(value); }}; }
+            template<typename T> static inline void get_input_shaper_damping(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->input_shaper_damping; }, [](void* ctx, float value){ ((T*)ctx)->set_input_shaper_damping(value); }}; }
+            template<typename T> static inline auto get_enable_disturbance_observer(T* obj) { return Property<bool>{&obj->enable_disturbance_observer}; }
+            template<typename T> static inline void get_enable_disturbance_observer(T* obj, void* ptr) { new (ptr) Property<bool>{&obj->enable_disturbance_observer}; }
+            template<typename T> static inline auto get_disturbance_observer_bandwidth(T* obj) { return Property<float>{&obj->disturbance_observer_bandwidth}; }
+            template<typename T> static inline void get_disturbance_observer_bandwidth(T* obj, void* ptr) { new (ptr) Property<float>{&obj->disturbance_observer_bandwidth}; }
+            template<typename T> static inline auto get_enable_friction_compensation(T* obj) { return Property<bool>{&obj->enable_friction_compensation}; }
+            template<typename T> static inline void get_enable_friction_compensation(T* obj, void* ptr) { new (ptr) Property<bool>{&obj->enable_friction_compensation}; }
+            template<typename T> static inline auto get_friction_coulomb(T* obj) { return Property<float>{&obj->friction_coulomb}; }
+            template<typename T> static inline void get_friction_coulomb(T* obj, void* ptr) { new (ptr) Property<float>{&obj->friction_coulomb}; }
+            template<typename T> static inline auto get_friction_stribeck(T* obj) { return Property<float>{&obj->friction_stribeck}; }
+            template<typename T> static inline void get_friction_stribeck(T* obj, void* ptr) { new (ptr) Property<float>{&obj->friction_stribeck}; }
+            template<typename T> static inline auto get_friction_stribeck_velocity(T* obj) { return Property<float>{&obj->friction_stribeck_velocity}; }
+            template<typename T> static inline void get_friction_stribeck_velocity(T* obj, void* ptr) { new (ptr) Property<float>{&obj->friction_stribeck_velocity}; }
+            template<typename T> static inline auto get_friction_viscous(T* obj) { return Property<float>{&obj->friction_viscous}; }
+            template<typename T> static inline void get_friction_viscous(T* obj, void* ptr) { new (ptr) Property<float>{&obj->friction_viscous}; }
+            template<typename T> static inline auto get_friction_zero_vel_band(T* obj) { return Property<float>{&obj->friction_zero_vel_band}; }
+            template<typename T> static inline void get_friction_zero_vel_band(T* obj, void* ptr) { new (ptr) Property<float>{&obj->friction_zero_vel_band}; }
+            template<typename T> static inline auto get_pos_gain_table(T* obj) { return &obj->pos_gain_table; }
+            template<typename T> static inline auto get_vel_gain_table(T* obj) { return &obj->vel_gain_table; }
         };
         class AutotuningIntf {
         public:
@@ -608,6 +724,81 @@ public:
             template<typename T> static inline void get_vel_amplitude(T* obj, void* ptr) { new (ptr) Property<float>{&obj->vel_amplitude}; }
             template<typename T> static inline auto get_torque_amplitude(T* obj) { return Property<float>{&obj->torque_amplitude}; }
             template<typename T> static inline void get_torque_amplitude(T* obj, void* ptr) { new (ptr) Property<float>{&obj->torque_amplitude}; }
+            template<typename T> static inline auto get_target_bandwidth(T* obj) { return Property<float>{&obj->target_bandwidth}; }
+            template<typename T> static inline void get_target_bandwidth(T* obj, void* ptr) { new (ptr) Property<float>{&obj->target_bandwidth}; }
+            template<typename T> static inline auto get_identification_duration(T* obj) { return Property<float>{&obj->identification_duration}; }
+            template<typename T> static inline void get_identification_duration(T* obj, void* ptr) { new (ptr) Property<float>{&obj->identification_duration}; }
+        };
+        class GainIdentificationIntf {
+        public:
+            template<typename T> static inline auto get_active(T* obj) { return Property<const bool>{&obj->active}; }
+            template<typename T> static inline void get_active(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->active}; }
+            template<typename T> static inline auto get_valid(T* obj) { return Property<const bool>{&obj->valid}; }
+            template<typename T> static inline void get_valid(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->valid}; }
+            template<typename T> static inline auto get_inertia(T* obj) { return Property<const float>{&obj->inertia}; }
+            template<typename T> static inline void get_inertia(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->inertia}; }
+            template<typename T> static inline auto get_viscous_friction(T* obj) { return Property<const float>{&obj->viscous_friction}; }
+            template<typename T> static inline void get_viscous_friction(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->viscous_friction}; }
+            template<typename T> static inline auto get_coulomb_friction(T* obj) { return Property<const float>{&obj->coulomb_friction}; }
+            template<typename T> static inline void get_coulomb_friction(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->coulomb_friction}; }
+        };
+        class FrequencyResponseIntf {
+        public:
+            template<typename T> static inline auto get_start_frequency(T* obj) { return Property<float>{&obj->start_frequency}; }
+            template<typename T> static inline void get_start_frequency(T* obj, void* ptr) { new (ptr) Property<float>{&obj->start_frequency}; }
+            template<typename T> static inline auto get_stop_frequency(T* obj) { return Property<float>{&obj->stop_frequency}; }
+            template<typename T> static inline void get_stop_frequency(T* obj, void* ptr) { new (ptr) Property<float>{&obj->stop_frequency}; }
+            template<typename T> static inline auto get_num_points(T* obj) { return Property<uint32_t>{&obj->num_points}; }
+            template<typename T> static inline void get_num_points(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->num_points}; }
+            template<typename T> static inline auto get_settle_cycles(T* obj) { return Property<uint32_t>{&obj->settle_cycles}; }
+            template<typename T> static inline void get_settle_cycles(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->settle_cycles}; }
+            template<typename T> static inline auto get_measure_cycles(T* obj) { return Property<uint32_t>{&obj->measure_cycles}; }
+            template<typename T> static inline void get_measure_cycles(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->measure_cycles}; }
+            template<typename T> static inline auto get_loop(T* obj) { return Property<ODriveIntf::ControllerIntf::ControlMode>{&obj->loop}; }
+            template<typename T> static inline void get_loop(T* obj, void* ptr) { new (ptr) Property<ODriveIntf::ControllerIntf::ControlMode>{&obj->loop}; }
+            template<typename T> static inline auto get_active(T* obj) { return Property<const bool>{&obj->active}; }
+            template<typename T> static inline void get_active(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->active}; }
+            template<typename T> static inline auto get_index(T* obj) { return Property<const uint32_t>{&obj->index}; }
+            template<typename T> static inline void get_index(T* obj, void* ptr) { new (ptr) Property<const uint32_t>{&obj->index}; }
+        };
+        class VelFilterIntf {
+        public:
+            template<typename T> static inline auto get_type(T* obj) { return Property<uint8_t>{obj, [](void* ctx){ return (uint8_t)((T*)ctx)->type; }, [](void* ctx, uint8_t value){ ((T*)ctx)->set_type(value); }}; }
+            template<typename T> static inline void get_type(T* obj, void* ptr) { new (ptr) Property<uint8_t>{obj, [](void* ctx){ return (uint8_t)((T*)ctx)->type; }, [](void* ctx, uint8_t value){ ((T*)ctx)->set_type(value); }}; }
+            template<typename T> static inline auto get_frequency(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->frequency; }, [](void* ctx, float value){ ((T*)ctx)->set_frequency(value); }}; }
+            template<typename T> static inline void get_frequency(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->frequency; }, [](void* ctx, float value){ ((T*)ctx)->set_frequency(value); }}; }
+            template<typename T> static inline auto get_q(T* obj) { return Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->q; }, [](void* ctx, float value){ ((T*)ctx)->set_q(value); }}; }
+            template<typename T> static inline void get_q(T* obj, void* ptr) { new (ptr) Property<float>{obj, [](void* ctx){ return (float)((T*)ctx)->q; }, [](void* ctx, float value){ ((T*)ctx)->set_q(value); }}; }
+        };
+        class FrictionCalibrationIntf {
+        public:
+            template<typename T> static inline auto get_min_vel(T* obj) { return Property<float>{&obj->min_vel}; }
+            template<typename T> static inline void get_min_vel(T* obj, void* ptr) { new (ptr) Property<float>{&obj->min_vel}; }
+            template<typename T> static inline auto get_max_vel(T* obj) { return Property<float>{&obj->max_vel}; }
+            template<typename T> static inline void get_max_vel(T* obj, void* ptr) { new (ptr) Property<float>{&obj->max_vel}; }
+            template<typename T> static inline auto get_num_points(T* obj) { return Property<uint32_t>{&obj->num_points}; }
+            template<typename T> static inline void get_num_points(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->num_points}; }
+            template<typename T> static inline auto get_settle_time(T* obj) { return Property<float>{&obj->settle_time}; }
+            template<typename T> static inline void get_settle_time(T* obj, void* ptr) { new (ptr) Property<float>{&obj->settle_time}; }
+            template<typename T> static inline auto get_measure_time(T* obj) { return Property<float>{&obj->measure_time}; }
+            template<typename T> static inline void get_measure_time(T* obj, void* ptr) { new (ptr) Property<float>{&obj->measure_time}; }
+            template<typename T> static inline auto get_active(T* obj) { return Property<const bool>{&obj->active}; }
+            template<typename T> static inline void get_active(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->active}; }
+            template<typename T> static inline auto get_valid(T* obj) { return Property<const bool>{&obj->valid}; }
+            template<typename T> static inline void get_valid(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->valid}; }
+            template<typename T> static inline auto get_index(T* obj) { return Property<const uint32_t>{&obj->index}; }
+            template<typename T> static inline void get_index(T* obj, void* ptr) { new (ptr) Property<const uint32_t>{&obj->index}; }
+        };
+        class GainTableIntf {
+        public:
+            template<typename T> static inline auto get_enabled(T* obj) { return Property<bool>{&obj->enabled}; }
+            template<typename T> static inline void get_enabled(T* obj, void* ptr) { new (ptr) Property<bool>{&obj->enabled}; }
+            template<typename T> static inline auto get_min(T* obj) { return Property<float>{&obj->min}; }
+            template<typename T> static inline void get_min(T* obj, void* ptr) { new (ptr) Property<float>{&obj->min}; }
+            template<typename T> static inline auto get_max(T* obj) { return Property<float>{&obj->max}; }
+            template<typename T> static inline void get_max(T* obj, void* ptr) { new (ptr) Property<float>{&obj->max}; }
+            template<typename T> static inline auto get_num_points(T* obj) { return Property<uint32_t>{&obj->num_points}; }
+            template<typename T> static inline void get_num_points(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->num_points}; }
         };
         enum Error {
             ERROR_NONE                       = 0x00000000,
@@ -667,10 +858,27 @@ public:
         template<typename T> static inline void get_mechanical_power(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->mechanical_power_}; }
         template<typename T> static inline auto get_electrical_power(T* obj) { return Property<const float>{&obj->electrical_power_}; }
         template<typename T> static inline void get_electrical_power(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->electrical_power_}; }
+        template<typename T> static inline auto get_gain_identification(T* obj) { return &obj->gain_identification_; }
+        template<typename T> static inline auto get_frequency_response(T* obj) { return &obj->frequency_response_; }
+        template<typename T> static inline auto get_load_torque_estimate(T* obj) { return Property<const float>{&obj->load_torque_estimate_}; }
+        template<typename T> static inline void get_load_torque_estimate(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->load_torque_estimate_}; }
+        template<typename T> static inline auto get_friction_calibration(T* obj) { return &obj->friction_calibration_; }
         virtual void move_incremental(float displacement, bool from_input_pos) = 0;
         virtual void start_anticogging_calibration() = 0;
         virtual float remove_anticogging_bias() = 0;
         virtual float get_anticogging_value(uint32_t index) = 0;
+        virtual bool start_gain_identification() = 0;
+        virtual bool apply_identified_gains() = 0;
+        virtual bool start_frequency_response() = 0;
+        virtual std::tuple<float, float, float> get_frequency_response_point(uint32_t index) = 0;
+        virtual bool start_friction_calibration() = 0;
+        virtual std::tuple<float, float> get_friction_calibration_point(uint32_t index) = 0;
+        virtual bool set_pos_gain_table_point(uint32_t index, float pos_gain, float vel_gain, float vel_integrator_gain) = 0;
+        virtual std::tuple<float, float, float> get_pos_gain_table_point(uint32_t index) = 0;
+        virtual bool set_vel_gain_table_point(uint32_t index, float pos_gain, float vel_gain, float vel_integrator_gain) = 0;
+        virtual std::tuple<float, float, float> get_vel_gain_table_point(uint32_t index) = 0;
+        virtual bool set_cam_point(uint32_t index, float pos) = 0;
+        virtual float get_cam_point(uint32_t index) = 0;
         float move_incremental_in_displacement_; // for internal use by Fibre
         template<typename T> static auto get_move_incremental_in_displacement_(T* obj) { return Property<float>{&obj->move_incremental_in_displacement_}; }
         template<typename T> static void get_move_incremental_in_displacement_(T* obj, void* ptr) { new (ptr) Property<float>{&obj->move_incremental_in_displacement_}; }
@@ -686,6 +894,108 @@ public:
         float get_anticogging_value_out_val_; // for internal use by Fibre
         template<typename T> static auto get_get_anticogging_value_out_val_(T* obj) { return Property<const float>{&obj->get_anticogging_value_out_val_}; }
         template<typename T> static void get_get_anticogging_value_out_val_(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->get_anticogging_value_out_val_}; }
+        bool start_gain_identification_out_success_; // for internal use by Fibre
+        template<typename T> static auto get_start_gain_identification_out_success_(T* obj) { return Property<const bool>{&obj->start_gain_identification_out_success_}; }
+        template<typename T> static void get_start_gain_identification_out_success_(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->start_gain_identification_out_success_}; }
+        bool apply_identified_gains_out_success_; // for internal use by Fibre
+        template<typename T> static auto get_apply_identified_gains_out_success_(T* obj) { return Property<const bool>{&obj->apply_identified_gains_out_success_}; }
+        template<typename T> static void get_apply_identified_gains_out_success_(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->apply_identified_gains_out_success_}; }
+        bool start_frequency_response_out_success_; // for internal use by Fibre
+        template<typename T> static auto get_start_frequency_response_out_success_(T* obj) { return Property<const bool>{&obj->start_frequency_response_out_success_}; }
+        template<typename T> static void get_start_frequency_response_out_success_(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->start_frequency_response_out_success_}; }
+        uint32_t get_frequency_response_point_in_index_; // for internal use by Fibre
+        template<typename T> static auto get_get_frequency_response_point_in_index_(T* obj) { return Property<uint32_t>{&obj->get_frequency_response_point_in_index_}; }
+        template<typename T> static void get_get_frequency_response_point_in_index_(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->get_frequency_response_point_in_index_}; }
+        float get_frequency_response_point_out_frequency_; // for internal use by Fibre
+        template<typename T> static auto get_get_frequency_response_point_out_frequency_(T* obj) { return Property<const float>{&obj->get_frequency_response_point_out_frequency_}; }
+        template<typename T> static void get_get_frequency_response_point_out_frequency_(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->get_frequency_response_point_out_frequency_}; }
+        float get_frequency_response_point_out_gain_; // for internal use by Fibre
+        template<typename T> static auto get_get_frequency_response_point_out_gain_(T* obj) { return Property<const float>{&obj->get_frequency_response_point_out_gain_}; }
+        template<typename T> static void get_get_frequency_response_point_out_gain_(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->get_frequency_response_point_out_gain_}; }
+        float get_frequency_response_point_out_phase_; // for internal use by Fibre
+        template<typename T> static auto get_get_frequency_response_point_out_phase_(T* obj) { return Property<const float>{&obj->get_frequency_response_point_out_phase_}; }
+        template<typename T> static void get_get_frequency_response_point_out_phase_(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->get_frequency_response_point_out_phase_}; }
+        bool start_friction_calibration_out_success_; // for internal use by Fibre
+        template<typename T> static auto get_start_friction_calibration_out_success_(T* obj) { return Property<const bool>{&obj->start_friction_calibration_out_success_}; }
+        template<typename T> static void get_start_friction_calibration_out_success_(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->start_friction_calibration_out_success_}; }
+        uint32_t get_friction_calibration_point_in_index_; // for internal use by Fibre
+        template<typename T> static auto get_get_friction_calibration_point_in_index_(T* obj) { return Property<uint32_t>{&obj->get_friction_calibration_point_in_index_}; }
+        template<typename T> static void get_get_friction_calibration_point_in_index_(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->get_friction_calibration_point_in_index_}; }
+        float get_friction_calibration_point_out_vel_; // for internal use by Fibre
+        template<typename T> static auto get_get_friction_calibration_point_out_vel_(T* obj) { return Property<const float>{&obj->get_friction_calibration_point_out_vel_}; }
+        template<typename T> static void get_get_friction_calibration_point_out_vel_(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->get_friction_calibration_point_out_vel_}; }
+        float get_friction_calibration_point_out_torque_; // for internal use by Fibre
+        template<typename T> static auto get_get_friction_calibration_point_out_torque_(T* obj) { return Property<const float>{&obj->get_friction_calibration_point_out_torque_}; }
+        template<typename T> static void get_get_friction_calibration_point_out_torque_(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->get_friction_calibration_point_out_torque_}; }
+        uint32_t set_pos_gain_table_point_in_index_; // for internal use by Fibre
+        template<typename T> static auto get_set_pos_gain_table_point_in_index_(T* obj) { return Property<uint32_t>{&obj->set_pos_gain_table_point_in_index_}; }
+        template<typename T> static void get_set_pos_gain_table_point_in_index_(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->set_pos_gain_table_point_in_index_}; }
+        float set_pos_gain_table_point_in_pos_gain_; // for internal use by Fibre
+        template<typename T> static auto get_set_pos_gain_table_point_in_pos_gain_(T* obj) { return Property<float>{&obj->set_pos_gain_table_point_in_pos_gain_}; }
+        template<typename T> static void get_set_pos_gain_table_point_in_pos_gain_(T* obj, void* ptr) { new (ptr) Property<float>{&obj->set_pos_gain_table_point_in_pos_gain_}; }
+        float set_pos_gain_table_point_in_vel_gain_; // for internal use by Fibre
+        template<typename T> static auto get_set_pos_gain_table_point_in_vel_gain_(T* obj) { return Property<float>{&obj->set_pos_gain_table_point_in_vel_gain_}; }
+        template<typename T> static void get_set_pos_gain_table_point_in_vel_gain_(T* obj, void* ptr) { new (ptr) Property<float>{&obj->set_pos_gain_table_point_in_vel_gain_}; }
+        float set_pos_gain_table_point_in_vel_integrator_gain_; // for internal use by Fibre
+        template<typename T> static auto get_set_pos_gain_table_point_in_vel_integrator_gain_(T* obj) { return Property<float>{&obj->set_pos_gain_table_point_in_vel_integrator_gain_}; }
+        template<typename T> static void get_set_pos_gain_table_point_in_vel_integrator_gain_(T* obj, void* ptr) { new (ptr) Property<float>{&obj->set_pos_gain_table_point_in_vel_integrator_gain_}; }
+        bool set_pos_gain_table_point_out_success_; // for internal use by Fibre
+        template<typename T> static auto get_set_pos_gain_table_point_out_success_(T* obj) { return Property<const bool>{&obj->set_pos_gain_table_point_out_success_}; }
+        template<typename T> static void get_set_pos_gain_table_point_out_success_(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->set_pos_gain_table_point_out_success_}; }
+        uint32_t get_pos_gain_table_point_in_index_; // for internal use by Fibre
+        template<typename T> static auto get_get_pos_gain_table_point_in_index_(T* obj) { return Property<uint32_t>{&obj->get_pos_gain_table_point_in_index_}; }
+        template<typename T> static void get_get_pos_gain_table_point_in_index_(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->get_pos_gain_table_point_in_index_}; }
+        float get_pos_gain_table_point_out_pos_gain_; // for internal use by Fibre
+        template<typename T> static auto get_get_pos_gain_table_point_out_pos_gain_(T* obj) { return Property<const float>{&obj->get_pos_gain_table_point_out_pos_gain_}; }
+        template<typename T> static void get_get_pos_gain_table_point_out_pos_gain_(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->get_pos_gain_table_point_out_pos_gain_}; }
+        float get_pos_gain_table_point_out_vel_gain_; // for internal use by Fibre
+        template<typename T> static auto get_get_pos_gain_table_point_out_vel_gain_(T* obj) { return Property<const float>{&obj->get_pos_gain_table_point_out_vel_gain_}; }
+        template<typename T> static void get_get_pos_gain_table_point_out_vel_gain_(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->get_pos_gain_table_point_out_vel_gain_}; }
+        float get_pos_gain_table_point_out_vel_integrator_gain_; // for internal use by Fibre
+        template<typename T> static auto get_get_pos_gain_table_point_out_vel_integrator_gain_(T* obj) { return Property<const float>{&obj->get_pos_gain_table_point_out_vel_integrator_gain_}; }
+        template<typename T> static void get_get_pos_gain_table_point_out_vel_integrator_gain_(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->get_pos_gain_table_point_out_vel_integrator_gain_}; }
+        uint32_t set_vel_gain_table_point_in_index_; // for internal use by Fibre
+        template<typename T> static auto get_set_vel_gain_table_point_in_index_(T* obj) { return Property<uint32_t>{&obj->set_vel_gain_table_point_in_index_}; }
+        template<typename T> static void get_set_vel_gain_table_point_in_index_(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->set_vel_gain_table_point_in_index_}; }
+        float set_vel_gain_table_point_in_pos_gain_; // for internal use by Fibre
+        template<typename T> static auto get_set_vel_gain_table_point_in_pos_gain_(T* obj) { return Property<float>{&obj->set_vel_gain_table_point_in_pos_gain_}; }
+        template<typename T> static void get_set_vel_gain_table_point_in_pos_gain_(T* obj, void* ptr) { new (ptr) Property<float>{&obj->set_vel_gain_table_point_in_pos_gain_}; }
+        float set_vel_gain_table_point_in_vel_gain_; // for internal use by Fibre
+        template<typename T> static auto get_set_vel_gain_table_point_in_vel_gain_(T* obj) { return Property<float>{&obj->set_vel_gain_table_point_in_vel_gain_}; }
+        template<typename T> static void get_set_vel_gain_table_point_in_vel_gain_(T* obj, void* ptr) { new (ptr) Property<float>{&obj->set_vel_gain_table_point_in_vel_gain_}; }
+        float set_vel_gain_table_point_in_vel_integrator_gain_; // for internal use by Fibre
+        template<typename T> static auto get_set_vel_gain_table_point_in_vel_integrator_gain_(T* obj) { return Property<float>{&obj->set_vel_gain_table_point_in_vel_integrator_gain_}; }
+        template<typename T> static void get_set_vel_gain_table_point_in_vel_integrator_gain_(T* obj, void* ptr) { new (ptr) Property<float>{&obj->set_vel_gain_table_point_in_vel_integrator_gain_}; }
+        bool set_vel_gain_table_point_out_success_; // for internal use by Fibre
+        template<typename T> static auto get_set_vel_gain_table_point_out_success_(T* obj) { return Property<const bool>{&obj->set_vel_gain_table_point_out_success_}; }
+        template<typename T> static void get_set_vel_gain_table_point_out_success_(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->set_vel_gain_table_point_out_success_}; }
+        uint32_t get_vel_gain_table_point_in_index_; // for internal use by Fibre
+        template<typename T> static auto get_get_vel_gain_table_point_in_index_(T* obj) { return Property<uint32_t>{&obj->get_vel_gain_table_point_in_index_}; }
+        template<typename T> static void get_get_vel_gain_table_point_in_index_(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->get_vel_gain_table_point_in_index_}; }
+        float get_vel_gain_table_point_out_pos_gain_; // for internal use by Fibre
+        template<typename T> static auto get_get_vel_gain_table_point_out_pos_gain_(T* obj) { return Property<const float>{&obj->get_vel_gain_table_point_out_pos_gain_}; }
+        template<typename T> static void get_get_vel_gain_table_point_out_pos_gain_(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->get_vel_gain_table_point_out_pos_gain_}; }
+        float get_vel_gain_table_point_out_vel_gain_; // for internal use by Fibre
+        template<typename T> static auto get_get_vel_gain_table_point_out_vel_gain_(T* obj) { return Property<const float>{&obj->get_vel_gain_table_point_out_vel_gain_}; }
+        template<typename T> static void get_get_vel_gain_table_point_out_vel_gain_(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->get_vel_gain_table_point_out_vel_gain_}; }
+        float get_vel_gain_table_point_out_vel_integrator_gain_; // for internal use by Fibre
+        template<typename T> static auto get_get_vel_gain_table_point_out_vel_integrator_gain_(T* obj) { return Property<const float>{&obj->get_vel_gain_table_point_out_vel_integrator_gain_}; }
+        template<typename T> static void get_get_vel_gain_table_point_out_vel_integrator_gain_(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->get_vel_gain_table_point_out_vel_integrator_gain_}; }
+        uint32_t set_cam_point_in_index_; // for internal use by Fibre
+        template<typename T> static auto get_set_cam_point_in_index_(T* obj) { return Property<uint32_t>{&obj->set_cam_point_in_index_}; }
+        template<typename T> static void get_set_cam_point_in_index_(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->set_cam_point_in_index_}; }
+        float set_cam_point_in_pos_; // for internal use by Fibre
+        template<typename T> static auto get_set_cam_point_in_pos_(T* obj) { return Property<float>{&obj->set_cam_point_in_pos_}; }
+        template<typename T> static void get_set_cam_point_in_pos_(T* obj, void* ptr) { new (ptr) Property<float>{&obj->set_cam_point_in_pos_}; }
+        bool set_cam_point_out_success_; // for internal use by Fibre
+        template<typename T> static auto get_set_cam_point_out_success_(T* obj) { return Property<const bool>{&obj->set_cam_point_out_success_}; }
+        template<typename T> static void get_set_cam_point_out_success_(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->set_cam_point_out_success_}; }
+        uint32_t get_cam_point_in_index_; // for internal use by Fibre
+        template<typename T> static auto get_get_cam_point_in_index_(T* obj) { return Property<uint32_t>{&obj->get_cam_point_in_index_}; }
+        template<typename T> static void get_get_cam_point_in_index_(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->get_cam_point_in_index_}; }
+        float get_cam_point_out_pos_; // for internal use by Fibre
+        template<typename T> static auto get_get_cam_point_out_pos_(T* obj) { return Property<const float>{&obj->get_cam_point_out_pos_}; }
+        template<typename T> static void get_get_cam_point_out_pos_(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->get_cam_point_out_pos_}; }
     };
     class EncoderIntf {
     public:
@@ -850,14 +1160,23 @@ public:
             template<typename T> static inline void get_enabled(T* obj, void* ptr) { new (ptr) Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enabled; }, [](void* ctx, bool value){ ((T*)ctx)->set_enabled(value); }}; }
             template<typename T> static inline auto get_offset(T* obj) { return Property<float>{&obj->offset}; }
             template<typename T> static inline void get_offset(T* obj, void* ptr) { new (ptr) Property<float>{&obj->offset}; }
-            template<typename T> static inline auto get_is_active_high(T* obj) { return Property<bool>{&obj->is_active_high}; }
-            template<typename T> static inline void get_is_active_high(T* obj, void* ptr) { new (ptr) Property<bool>{&obj->is_active_high}; }
+            template<typename T> static inline auto get_is_active_high(T* obj) { return Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->is_active_high; }, [](void* ctx, bool value){ ((T*)ctx)->set_is_active_high(value); }}; }
+            template<typename T> static inline void get_is_active_high(T* obj, void* ptr) { new (ptr) Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->is_active_high; }, [](void* ctx, bool value){ ((T*)ctx)->set_is_active_high(value); }}; }
             template<typename T> static inline auto get_debounce_ms(T* obj) { return Property<uint32_t>{obj, [](void* ctx){ return (uint32_t)((T*)ctx)->debounce_ms; }, [](void* ctx, uint32_t value){ ((T*)ctx)->set_debounce_ms(value); }}; }
             template<typename T> static inline void get_debounce_ms(T* obj, void* ptr) { new (ptr) Property<uint32_t>{obj, [](void* ctx){ return (uint32_t)((T*)ctx)->debounce_ms; }, [](void* ctx, uint32_t value){ ((T*)ctx)->set_debounce_ms(value); }}; }
+            template<typename T> static inline auto get_enable_edge_capture(T* obj) { return Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enable_edge_capture; }, [](void* ctx, bool value){ ((T*)ctx)->set_enable_edge_capture(value); }}; }
+            template<typename T> static inline void get_enable_edge_capture(T* obj, void* ptr) { new (ptr) Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enable_edge_capture; }, [](void* ctx, bool value){ ((T*)ctx)->set_enable_edge_capture(value); }}; }
         };
         template<typename T> static inline auto get_endstop_state(T* obj) { return Property<const bool>{&obj->endstop_state_}; }
         template<typename T> static inline void get_endstop_state(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->endstop_state_}; }
         template<typename T> static inline auto get_config(T* obj) { return &obj->config_; }
+        template<typename T> static inline auto get_latched(T* obj) { return Property<const bool>{&obj->latched_}; }
+        template<typename T> static inline void get_latched(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->latched_}; }
+        template<typename T> static inline auto get_latch_pos(T* obj) { return Property<const float>{&obj->latch_pos_}; }
+        template<typename T> static inline void get_latch_pos(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->latch_pos_}; }
+        template<typename T> static inline auto get_edge_capture(T* obj) { return Property<const bool>{&obj->edge_capture_}; }
+        template<typename T> static inline void get_edge_capture(T* obj, void* ptr) { new (ptr) Property<const bool>{&obj->edge_capture_}; }
+        virtual void arm_latch() = 0;
     };
     class MechanicalBrakeIntf {
     public:
@@ -872,6 +1191,103 @@ public:
         virtual void engage() = 0;
         virtual void release() = 0;
     };
+    class PositionCompareIntf {
+    public:
+        class ConfigIntf {
+        public:
+            template<typename T> static inline auto get_enabled(T* obj) { return Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enabled; }, [](void* ctx, bool value){ ((T*)ctx)->set_enabled(value); }}; }
+            template<typename T> static inline void get_enabled(T* obj, void* ptr) { new (ptr) Property<bool>{obj, [](void* ctx){ return (bool)((T*)ctx)->enabled; }, [](void* ctx, bool value){ ((T*)ctx)->set_enabled(value); }}; }
+            template<typename T> static inline auto get_gpio_num(T* obj) { return Property<uint16_t>{obj, [](void* ctx){ return (uint16_t)((T*)ctx)->gpio_num; }, [](void* ctx, uint16_t value){ ((T*)ctx)->set_gpio_num(value); }}; }
+            template<typename T> static inline void get_gpio_num(T* obj, void* ptr) { new (ptr) Property<uint16_t>{obj, [](void* ctx){ return (uint16_t)((T*)ctx)->gpio_num; }, [](void* ctx, uint16_t value){ ((T*)ctx)->set_gpio_num(value); }}; }
+            template<typename T> static inline auto get_is_active_high(T* obj) { return Property<bool>{&obj->is_active_high}; }
+            template<typename T> static inline void get_is_active_high(T* obj, void* ptr) { new (ptr) Property<bool>{&obj->is_active_high}; }
+            template<typename T> static inline auto get_mode(T* obj) { return Property<uint8_t>{&obj->mode}; }
+            template<typename T> static inline void get_mode(T* obj, void* ptr) { new (ptr) Property<uint8_t>{&obj->mode}; }
+            template<typename T> static inline auto get_interval_start(T* obj) { return Property<float>{&obj->interval_start}; }
+            template<typename T> static inline void get_interval_start(T* obj, void* ptr) { new (ptr) Property<float>{&obj->interval_start}; }
+            template<typename T> static inline auto get_interval(T* obj) { return Property<float>{&obj->interval}; }
+            template<typename T> static inline void get_interval(T* obj, void* ptr) { new (ptr) Property<float>{&obj->interval}; }
+            template<typename T> static inline auto get_num_positions(T* obj) { return Property<uint32_t>{&obj->num_positions}; }
+            template<typename T> static inline void get_num_positions(T* obj, void* ptr) { new (ptr) Property<uint32_t>{&obj->num_positions}; }
+            template<typename T> static inline auto get_position0(T* obj) { return Property<float>{&obj->positions[0]}; }
+            template<typename T> static inline void get_position0(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[0]}; }
+            template<typename T> static inline auto get_position1(T* obj) { return Property<float>{&obj->positions[1]}; }
+            template<typename T> static inline void get_position1(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[1]}; }
+            template<typename T> static inline auto get_position2(T* obj) { return Property<float>{&obj->positions[2]}; }
+            template<typename T> static inline void get_position2(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[2]}; }
+            template<typename T> static inline auto get_position3(T* obj) { return Property<float>{&obj->positions[3]}; }
+            template<typename T> static inline void get_position3(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[3]}; }
+            template<typename T> static inline auto get_position4(T* obj) { return Property<float>{&obj->positions[4]}; }
+            template<typename T> static inline void get_position4(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[4]}; }
+            template<typename T> static inline auto get_position5(T* obj) { return Property<float>{&obj->positions[5]}; }
+            template<typename T> static inline void get_position5(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[5]}; }
+            template<typename T> static inline auto get_position6(T* obj) { return Property<float>{&obj->positions[6]}; }
+            template<typename T> static inline void get_position6(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[6]}; }
+            template<typename T> static inline auto get_position7(T* obj) { return Property<float>{&obj->positions[7]}; }
+            template<typename T> static inline void get_position7(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[7]}; }
+            template<typename T> static inline auto get_position8(T* obj) { return Property<float>{&obj->positions[8]}; }
+            template<typename T> static inline void get_position8(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[8]}; }
+            template<typename T> static inline auto get_position9(T* obj) { return Property<float>{&obj->positions[9]}; }
+            template<typename T> static inline void get_position9(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[9]}; }
+            template<typename T> static inline auto get_position10(T* obj) { return Property<float>{&obj->positions[10]}; }
+            template<typename T> static inline void get_position10(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[10]}; }
+            template<typename T> static inline auto get_position11(T* obj) { return Property<float>{&obj->positions[11]}; }
+            template<typename T> static inline void get_position11(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[11]}; }
+            template<typename T> static inline auto get_position12(T* obj) { return Property<float>{&obj->positions[12]}; }
+            template<typename T> static inline void get_position12(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[12]}; }
+            template<typename T> static inline auto get_position13(T* obj) { return Property<float>{&obj->positions[13]}; }
+            template<typename T> static inline void get_position13(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[13]}; }
+            template<typename T> static inline auto get_position14(T* obj) { return Property<float>{&obj->positions[14]}; }
+            template<typename T> static inline void get_position14(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[14]}; }
+            template<typename T> static inline auto get_position15(T* obj) { return Property<float>{&obj->positions[15]}; }
+            template<typename T> static inline void get_position15(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[15]}; }
+            template<typename T> static inline auto get_position16(T* obj) { return Property<float>{&obj->positions[16]}; }
+            template<typename T> static inline void get_position16(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[16]}; }
+            template<typename T> static inline auto get_position17(T* obj) { return Property<float>{&obj->positions[17]}; }
+            template<typename T> static inline void get_position17(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[17]}; }
+            template<typename T> static inline auto get_position18(T* obj) { return Property<float>{&obj->positions[18]}; }
+            template<typename T> static inline void get_position18(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[18]}; }
+            template<typename T> static inline auto get_position19(T* obj) { return Property<float>{&obj->positions[19]}; }
+            template<typename T> static inline void get_position19(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[19]}; }
+            template<typename T> static inline auto get_position20(T* obj) { return Property<float>{&obj->positions[20]}; }
+            template<typename T> static inline void get_position20(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[20]}; }
+            template<typename T> static inline auto get_position21(T* obj) { return Property<float>{&obj->positions[21]}; }
+            template<typename T> static inline void get_position21(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[21]}; }
+            template<typename T> static inline auto get_position22(T* obj) { return Property<float>{&obj->positions[22]}; }
+            template<typename T> static inline void get_position22(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[22]}; }
+            template<typename T> static inline auto get_position23(T* obj) { return Property<float>{&obj->positions[23]}; }
+            template<typename T> static inline void get_position23(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[23]}; }
+            template<typename T> static inline auto get_position24(T* obj) { return Property<float>{&obj->positions[24]}; }
+            template<typename T> static inline void get_position24(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[24]}; }
+            template<typename T> static inline auto get_position25(T* obj) { return Property<float>{&obj->positions[25]}; }
+            template<typename T> static inline void get_position25(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[25]}; }
+            template<typename T> static inline auto get_position26(T* obj) { return Property<float>{&obj->positions[26]}; }
+            template<typename T> static inline void get_position26(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[26]}; }
+            template<typename T> static inline auto get_position27(T* obj) { return Property<float>{&obj->positions[27]}; }
+            template<typename T> static inline void get_position27(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[27]}; }
+            template<typename T> static inline auto get_position28(T* obj) { return Property<float>{&obj->positions[28]}; }
+            template<typename T> static inline void get_position28(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[28]}; }
+            template<typename T> static inline auto get_position29(T* obj) { return Property<float>{&obj->positions[29]}; }
+            template<typename T> static inline void get_position29(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[29]}; }
+            template<typename T> static inline auto get_position30(T* obj) { return Property<float>{&obj->positions[30]}; }
+            template<typename T> static inline void get_position30(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[30]}; }
+            template<typename T> static inline auto get_position31(T* obj) { return Property<float>{&obj->positions[31]}; }
+            template<typename T> static inline void get_position31(T* obj, void* ptr) { new (ptr) Property<float>{&obj->positions[31]}; }
+            template<typename T> static inline auto get_pulse_width(T* obj) { return Property<float>{&obj->pulse_width}; }
+            template<typename T> static inline void get_pulse_width(T* obj, void* ptr) { new (ptr) Property<float>{&obj->pulse_width}; }
+        };
+        template<typename T> static inline auto get_trigger_count(T* obj) { return Property<const uint32_t>{&obj->trigger_count_}; }
+        template<typename T> static inline void get_trigger_count(T* obj, void* ptr) { new (ptr) Property<const uint32_t>{&obj->trigger_count_}; }
+        template<typename T> static inline auto get_last_trigger_pos(T* obj) { return Property<const float>{&obj->last_trigger_pos_}; }
+        template<typename T> static inline void get_last_trigger_pos(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->last_trigger_pos_}; }
+        template<typename T> static inline auto get_last_trigger_tick(T* obj) { return Property<const uint32_t>{&obj->last_trigger_tick_}; }
+        template<typename T> static inline void get_last_trigger_tick(T* obj, void* ptr) { new (ptr) Property<const uint32_t>{&obj->last_trigger_tick_}; }
+        template<typename T> static inline auto get_last_trigger_offset(T* obj) { return Property<const float>{&obj->last_trigger_offset_}; }
+        template<typename T> static inline void get_last_trigger_offset(T* obj, void* ptr) { new (ptr) Property<const float>{&obj->last_trigger_offset_}; }
+        template<typename T> static inline auto get_tick_count(T* obj) { return Property<const uint32_t>{&obj->tick_count_}; }
+        template<typename T> static inline void get_tick_count(T* obj, void* ptr) { new (ptr) Property<const uint32_t>{&obj->tick_count_}; }
+        template<typename T> static inline auto get_config(T* obj) { return &obj->config_; }
+    };
     class TaskTimerIntf {
     public:
         template<typename T> static inline auto get_start_time(T* obj) { return Property<const uint32_t>{&obj->start_time_}; }
@@ -93,6 +93,9 @@ struct ODriveConfigTypeInfo : TypeInfo {
             case 22: *(decltype(ODriveIntf::ConfigIntf::get_error_gpio_pin(std::declval<T*>()))*)(&res) = ODriveIntf::ConfigIntf::get_error_gpio_pin(ptr); break;
             case 23: *(decltype(ODriveIntf::ConfigIntf::get_gpio3_analog_mapping(std::declval<T*>()))*)(&res) = ODriveIntf::ConfigIntf::get_gpio3_analog_mapping(ptr); break;
             case 24: *(decltype(ODriveIntf::ConfigIntf::get_gpio4_analog_mapping(std::declval<T*>()))*)(&res) = ODriveIntf::ConfigIntf::get_gpio4_analog_mapping(ptr); break;
+            case 25: *(decltype(ODriveIntf::ConfigIntf::get_kinematics(std::declval<T*>()))*)(&res) = ODriveIntf::ConfigIntf::get_kinematics(ptr); break;
+            case 26: *(decltype(ODriveIntf::ConfigIntf::get_motion_queue(std::declval<T*>()))*)(&res) = ODriveIntf::ConfigIntf::get_motion_queue(ptr); break;
+            case 27: *(decltype(ODriveIntf::ConfigIntf::get_enable_double_pwm_update(std::declval<T*>()))*)(&res) = ODriveIntf::ConfigIntf::get_enable_double_pwm_update(ptr); break;
         }
         return res;
     }
@@ -162,8 +165,10 @@ struct ODriveAxisTypeInfo : TypeInfo {
             case 13: *(decltype(ODriveIntf::AxisIntf::get_trap_traj(std::declval<T*>()))*)(&res) = ODriveIntf::AxisIntf::get_trap_traj(ptr); break;
             case 14: *(decltype(ODriveIntf::AxisIntf::get_min_endstop(std::declval<T*>()))*)(&res) = ODriveIntf::AxisIntf::get_min_endstop(ptr); break;
             case 15: *(decltype(ODriveIntf::AxisIntf::get_max_endstop(std::declval<T*>()))*)(&res) = ODriveIntf::AxisIntf::get_max_endstop(ptr); break;
-            case 16: *(decltype(ODriveIntf::AxisIntf::get_mechanical_brake(std::declval<T*>()))*)(&res) = ODriveIntf::AxisIntf::get_mechanical_brake(ptr); break;
-            case 17: *(decltype(ODriveIntf::AxisIntf::get_task_times(std::declval<T*>()))*)(&res) = ODriveIntf::AxisIntf::get_task_times(ptr); break;
+            case 16: *(decltype(ODriveIntf::AxisIntf::get_probe(std::declval<T*>()))*)(&res) = ODriveIntf::AxisIntf::get_probe(ptr); break;
+            case 17: *(decltype(ODriveIntf::AxisIntf::get_mechanical_brake(std::declval<T*>()))*)(&res) = ODriveIntf::AxisIntf::get_mechanical_brake(ptr); break;
+            case 18: *(decltype(ODriveIntf::AxisIntf::get_position_compare(std::declval<T*>()))*)(&res) = ODriveIntf::AxisIntf::get_position_compare(ptr); break;
+            case 19: *(decltype(ODriveIntf::AxisIntf::get_task_times(std::declval<T*>()))*)(&res) = ODriveIntf::AxisIntf::get_task_times(ptr); break;
         }
         return res;
     }
@@ -298,14 +303,15 @@ struct ODriveMotorTypeInfo : TypeInfo {
             case 10: *(decltype(ODriveIntf::MotorIntf::get_I_bus(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_I_bus(ptr); break;
             case 11: *(decltype(ODriveIntf::MotorIntf::get_phase_current_rev_gain(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_phase_current_rev_gain(ptr); break;
             case 12: *(decltype(ODriveIntf::MotorIntf::get_effective_current_lim(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_effective_current_lim(ptr); break;
-            case 13: *(decltype(ODriveIntf::MotorIntf::get_max_allowed_current(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_max_allowed_current(ptr); break;
-            case 14: *(decltype(ODriveIntf::MotorIntf::get_max_dc_calib(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_max_dc_calib(ptr); break;
-            case 15: *(decltype(ODriveIntf::MotorIntf::get_fet_thermistor(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_fet_thermistor(ptr); break;
-            case 16: *(decltype(ODriveIntf::MotorIntf::get_motor_thermistor(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_motor_thermistor(ptr); break;
-            case 17: *(decltype(ODriveIntf::MotorIntf::get_current_control(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_current_control(ptr); break;
-            case 18: *(decltype(ODriveIntf::MotorIntf::get_n_evt_current_measurement(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_n_evt_current_measurement(ptr); break;
-            case 19: *(decltype(ODriveIntf::MotorIntf::get_n_evt_pwm_update(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_n_evt_pwm_update(ptr); break;
-            case 20: *(decltype(ODriveIntf::MotorIntf::get_config(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_config(ptr); break;
+            case 13: *(decltype(ODriveIntf::MotorIntf::get_field_weakening_id(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_field_weakening_id(ptr); break;
+            case 14: *(decltype(ODriveIntf::MotorIntf::get_max_allowed_current(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_max_allowed_current(ptr); break;
+            case 15: *(decltype(ODriveIntf::MotorIntf::get_max_dc_calib(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_max_dc_calib(ptr); break;
+            case 16: *(decltype(ODriveIntf::MotorIntf::get_fet_thermistor(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_fet_thermistor(ptr); break;
+            case 17: *(decltype(ODriveIntf::MotorIntf::get_motor_thermistor(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_motor_thermistor(ptr); break;
+            case 18: *(decltype(ODriveIntf::MotorIntf::get_current_control(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_current_control(ptr); break;
+            case 19: *(decltype(ODriveIntf::MotorIntf::get_n_evt_current_measurement(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_n_evt_current_measurement(ptr); break;
+            case 20: *(decltype(ODriveIntf::MotorIntf::get_n_evt_pwm_update(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_n_evt_pwm_update(ptr); break;
+            case 21: *(decltype(ODriveIntf::MotorIntf::get_config(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::get_config(ptr); break;
         }
         return res;
     }
@@ -377,6 +383,10 @@ struct ODriveControllerTypeInfo : TypeInfo {
             case 13: *(decltype(ODriveIntf::ControllerIntf::get_autotuning(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::get_autotuning(ptr); break;
             case 14: *(decltype(ODriveIntf::ControllerIntf::get_mechanical_power(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::get_mechanical_power(ptr); break;
             case 15: *(decltype(ODriveIntf::ControllerIntf::get_electrical_power(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::get_electrical_power(ptr); break;
+            case 16: *(decltype(ODriveIntf::ControllerIntf::get_gain_identification(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::get_gain_identification(ptr); break;
+            case 17: *(decltype(ODriveIntf::ControllerIntf::get_frequency_response(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::get_frequency_response(ptr); break;
+            case 18: *(decltype(ODriveIntf::ControllerIntf::get_load_torque_estimate(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::get_load_torque_estimate(ptr); break;
+            case 19: *(decltype(ODriveIntf::ControllerIntf::get_friction_calibration(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::get_friction_calibration(ptr); break;
         }
         return res;
     }
@@ -469,6 +479,9 @@ struct ODriveEndstopTypeInfo : TypeInfo {
         switch (idx) {
             case 0: *(decltype(ODriveIntf::EndstopIntf::get_endstop_state(std::declval<T*>()))*)(&res) = ODriveIntf::EndstopIntf::get_endstop_state(ptr); break;
             case 1: *(decltype(ODriveIntf::EndstopIntf::get_config(std::declval<T*>()))*)(&res) = ODriveIntf::EndstopIntf::get_config(ptr); break;
+            case 2: *(decltype(ODriveIntf::EndstopIntf::get_latched(std::declval<T*>()))*)(&res) = ODriveIntf::EndstopIntf::get_latched(ptr); break;
+            case 3: *(decltype(ODriveIntf::EndstopIntf::get_latch_pos(std::declval<T*>()))*)(&res) = ODriveIntf::EndstopIntf::get_latch_pos(ptr); break;
+            case 4: *(decltype(ODriveIntf::EndstopIntf::get_edge_capture(std::declval<T*>()))*)(&res) = ODriveIntf::EndstopIntf::get_edge_capture(ptr); break;
         }
         return res;
     }
@@ -491,6 +504,28 @@ struct ODriveMechanicalBrakeTypeInfo : TypeInfo {
     }
 };
 
+template<typename T>
+struct ODrivePositionCompareTypeInfo : TypeInfo {
+    using TypeInfo::TypeInfo;
+    static const PropertyInfo property_table[];
+    static const ODrivePositionCompareTypeInfo<T> singleton;
+    static Introspectable make_introspectable(T& obj) { return TypeInfo::make_introspectable(&obj, &singleton); }
+
+    introspectable_storage_t get_child(introspectable_storage_t obj, size_t idx) const override {
+        T* ptr = *(T**)&obj;
+        introspectable_storage_t res;
+        switch (idx) {
+            case 0: *(decltype(ODriveIntf::PositionCompareIntf::get_trigger_count(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::get_trigger_count(ptr); break;
+            case 1: *(decltype(ODriveIntf::PositionCompareIntf::get_last_trigger_pos(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::get_last_trigger_pos(ptr); break;
+            case 2: *(decltype(ODriveIntf::PositionCompareIntf::get_last_trigger_tick(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::get_last_trigger_tick(ptr); break;
+            case 3: *(decltype(ODriveIntf::PositionCompareIntf::get_last_trigger_offset(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::get_last_trigger_offset(ptr); break;
+            case 4: *(decltype(ODriveIntf::PositionCompareIntf::get_tick_count(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::get_tick_count(ptr); break;
+            case 5: *(decltype(ODriveIntf::PositionCompareIntf::get_config(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::get_config(ptr); break;
+        }
+        return res;
+    }
+};
+
 template<typename T>
 struct ODriveTaskTimerTypeInfo : TypeInfo {
     using TypeInfo::TypeInfo;
@@ -653,6 +688,46 @@ struct ODriveSystemStatsI2CTypeInfo : TypeInfo {
     }
 };
 
+template<typename T>
+struct ODriveConfigKinematicsTypeInfo : TypeInfo {
+    using TypeInfo::TypeInfo;
+    static const PropertyInfo property_table[];
+    static const ODriveConfigKinematicsTypeInfo<T> singleton;
+    static Introspectable make_introspectable(T& obj) { return TypeInfo::make_introspectable(&obj, &singleton); }
+
+    introspectable_storage_t get_child(introspectable_storage_t obj, size_t idx) const override {
+        T* ptr = *(T**)&obj;
+        introspectable_storage_t res;
+        switch (idx) {
+            case 0: *(decltype(ODriveIntf::ConfigIntf::KinematicsIntf::get_type(std::declval<T*>()))*)(&res) = ODriveIntf::ConfigIntf::KinematicsIntf::get_type(ptr); break;
+            case 1: *(decltype(ODriveIntf::ConfigIntf::KinematicsIntf::get_scale(std::declval<T*>()))*)(&res) = ODriveIntf::ConfigIntf::KinematicsIntf::get_scale(ptr); break;
+            case 2: *(decltype(ODriveIntf::ConfigIntf::KinematicsIntf::get_matrix0(std::declval<T*>()))*)(&res) = ODriveIntf::ConfigIntf::KinematicsIntf::get_matrix0(ptr); break;
+            case 3: *(decltype(ODriveIntf::ConfigIntf::KinematicsIntf::get_matrix1(std::declval<T*>()))*)(&res) = ODriveIntf::ConfigIntf::KinematicsIntf::get_matrix1(ptr); break;
+            case 4: *(decltype(ODriveIntf::ConfigIntf::KinematicsIntf::get_matrix2(std::declval<T*>()))*)(&res) = ODriveIntf::ConfigIntf::KinematicsIntf::get_matrix2(ptr); break;
+            case 5: *(decltype(ODriveIntf::ConfigIntf::KinematicsIntf::get_matrix3(std::declval<T*>()))*)(&res) = ODriveIntf::ConfigIntf::KinematicsIntf::get_matrix3(ptr); break;
+        }
+        return res;
+    }
+};
+
+template<typename T>
+struct ODriveConfigMotionQueueTypeInfo : TypeInfo {
+    using TypeInfo::TypeInfo;
+    static const PropertyInfo property_table[];
+    static const ODriveConfigMotionQueueTypeInfo<T> singleton;
+    static Introspectable make_introspectable(T& obj) { return TypeInfo::make_introspectable(&obj, &singleton); }
+
+    introspectable_storage_t get_child(introspectable_storage_t obj, size_t idx) const override {
+        T* ptr = *(T**)&obj;
+        introspectable_storage_t res;
+        switch (idx) {
+            case 0: *(decltype(ODriveIntf::ConfigIntf::MotionQueueIntf::get_accel_limit(std::declval<T*>()))*)(&res) = ODriveIntf::ConfigIntf::MotionQueueIntf::get_accel_limit(ptr); break;
+            case 1: *(decltype(ODriveIntf::ConfigIntf::MotionQueueIntf::get_rapid_rate(std::declval<T*>()))*)(&res) = ODriveIntf::ConfigIntf::MotionQueueIntf::get_rapid_rate(ptr); break;
+        }
+        return res;
+    }
+};
+
 template<typename T>
 struct ODriveCanConfigTypeInfo : TypeInfo {
     using TypeInfo::TypeInfo;
@@ -845,28 +920,45 @@ struct ODriveMotorConfigTypeInfo : TypeInfo {
             case 1: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_pole_pairs(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_pole_pairs(ptr); break;
             case 2: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_calibration_current(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_calibration_current(ptr); break;
             case 3: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_resistance_calib_max_voltage(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_resistance_calib_max_voltage(ptr); break;
-            case 4: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_phase_inductance(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_phase_inductance(ptr); break;
-            case 5: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_phase_resistance(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_phase_resistance(ptr); break;
-            case 6: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_torque_constant(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_torque_constant(ptr); break;
-            case 7: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_motor_type(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_motor_type(ptr); break;
-            case 8: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_current_lim(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_current_lim(ptr); break;
-            case 9: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_current_lim_margin(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_current_lim_margin(ptr); break;
-            case 10: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_torque_lim(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_torque_lim(ptr); break;
-            case 11: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_inverter_temp_limit_lower(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_inverter_temp_limit_lower(ptr); break;
-            case 12: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_inverter_temp_limit_upper(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_inverter_temp_limit_upper(ptr); break;
-            case 13: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_requested_current_range(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_requested_current_range(ptr); break;
-            case 14: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_current_control_bandwidth(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_current_control_bandwidth(ptr); break;
-            case 15: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_acim_gain_min_flux(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_acim_gain_min_flux(ptr); break;
-            case 16: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_min_Id(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_min_Id(ptr); break;
-            case 17: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_enable(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_enable(ptr); break;
-            case 18: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_attack_gain(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_attack_gain(ptr); break;
-            case 19: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_decay_gain(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_decay_gain(ptr); break;
-            case 20: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_R_wL_FF_enable(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_R_wL_FF_enable(ptr); break;
-            case 21: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_bEMF_FF_enable(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_bEMF_FF_enable(ptr); break;
-            case 22: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_I_bus_hard_min(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_I_bus_hard_min(ptr); break;
-            case 23: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_I_bus_hard_max(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_I_bus_hard_max(ptr); break;
-            case 24: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_I_leak_max(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_I_leak_max(ptr); break;
-            case 25: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_dc_calib_tau(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_dc_calib_tau(ptr); break;
+            case 4: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_calibration_tolerance(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_calibration_tolerance(ptr); break;
+            case 5: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_phase_inductance(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_phase_inductance(ptr); break;
+            case 6: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_phase_resistance(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_phase_resistance(ptr); break;
+            case 7: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_torque_constant(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_torque_constant(ptr); break;
+            case 8: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_motor_type(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_motor_type(ptr); break;
+            case 9: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_current_lim(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_current_lim(ptr); break;
+            case 10: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_current_lim_margin(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_current_lim_margin(ptr); break;
+            case 11: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_torque_lim(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_torque_lim(ptr); break;
+            case 12: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_inverter_temp_limit_lower(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_inverter_temp_limit_lower(ptr); break;
+            case 13: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_inverter_temp_limit_upper(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_inverter_temp_limit_upper(ptr); break;
+            case 14: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_requested_current_range(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_requested_current_range(ptr); break;
+            case 15: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_current_control_bandwidth(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_current_control_bandwidth(ptr); break;
+            case 16: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_acim_gain_min_flux(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_acim_gain_min_flux(ptr); break;
+            case 17: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_min_Id(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_min_Id(ptr); break;
+            case 18: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_enable(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_enable(ptr); break;
+            case 19: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_attack_gain(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_attack_gain(ptr); break;
+            case 20: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_decay_gain(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_acim_autoflux_decay_gain(ptr); break;
+            case 21: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_R_wL_FF_enable(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_R_wL_FF_enable(ptr); break;
+            case 22: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_bEMF_FF_enable(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_bEMF_FF_enable(ptr); break;
+            case 23: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_I_bus_hard_min(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_I_bus_hard_min(ptr); break;
+            case 24: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_I_bus_hard_max(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_I_bus_hard_max(ptr); break;
+            case 25: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_I_leak_max(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_I_leak_max(ptr); break;
+            case 26: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_dc_calib_tau(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_dc_calib_tau(ptr); break;
+            case 27: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_max_modulation(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_max_modulation(ptr); break;
+            case 28: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_enable_overmodulation(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_enable_overmodulation(ptr); break;
+            case 29: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_enable_field_weakening(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_enable_field_weakening(ptr); break;
+            case 30: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_field_weakening_modulation(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_field_weakening_modulation(ptr); break;
+            case 31: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_field_weakening_gain(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_field_weakening_gain(ptr); break;
+            case 32: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_field_weakening_max_current(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_field_weakening_max_current(ptr); break;
+            case 33: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_enable_mtpa(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_enable_mtpa(ptr); break;
+            case 34: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_phase_inductance_d(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_phase_inductance_d(ptr); break;
+            case 35: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_phase_inductance_q(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_phase_inductance_q(ptr); break;
+            case 36: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_enable_complex_vector_current_control(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_enable_complex_vector_current_control(ptr); break;
+            case 37: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_enable_dead_time_comp(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_enable_dead_time_comp(ptr); break;
+            case 38: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_dead_time_comp_time(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_dead_time_comp_time(ptr); break;
+            case 39: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_dead_time_comp_voltage(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_dead_time_comp_voltage(ptr); break;
+            case 40: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_dead_time_comp_current_band(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_dead_time_comp_current_band(ptr); break;
+            case 41: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_enable_deadbeat_current_control(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_enable_deadbeat_current_control(ptr); break;
+            case 42: *(decltype(ODriveIntf::MotorIntf::ConfigIntf::get_deadbeat_gain(std::declval<T*>()))*)(&res) = ODriveIntf::MotorIntf::ConfigIntf::get_deadbeat_gain(ptr); break;
         }
         return res;
     }
@@ -919,17 +1011,38 @@ struct ODriveControllerConfigTypeInfo : TypeInfo {
             case 16: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_circular_setpoint_range(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_circular_setpoint_range(ptr); break;
             case 17: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_steps_per_circular_range(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_steps_per_circular_range(ptr); break;
             case 18: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_homing_speed(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_homing_speed(ptr); break;
-            case 19: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_inertia(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_inertia(ptr); break;
-            case 20: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_axis_to_mirror(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_axis_to_mirror(ptr); break;
-            case 21: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_mirror_ratio(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_mirror_ratio(ptr); break;
-            case 22: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_torque_mirror_ratio(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_torque_mirror_ratio(ptr); break;
-            case 23: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_load_encoder_axis(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_load_encoder_axis(ptr); break;
-            case 24: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_input_filter_bandwidth(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_input_filter_bandwidth(ptr); break;
-            case 25: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_anticogging(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_anticogging(ptr); break;
-            case 26: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_mechanical_power_bandwidth(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_mechanical_power_bandwidth(ptr); break;
-            case 27: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_electrical_power_bandwidth(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_electrical_power_bandwidth(ptr); break;
-            case 28: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_spinout_mechanical_power_threshold(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_spinout_mechanical_power_threshold(ptr); break;
-            case 29: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_spinout_electrical_power_threshold(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_spinout_electrical_power_threshold(ptr); break;
+            case 19: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_homing_fast_speed(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_homing_fast_speed(ptr); break;
+            case 20: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_homing_backoff_distance(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_homing_backoff_distance(ptr); break;
+            case 21: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_inertia(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_inertia(ptr); break;
+            case 22: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_axis_to_mirror(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_axis_to_mirror(ptr); break;
+            case 23: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_mirror_ratio(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_mirror_ratio(ptr); break;
+            case 24: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_torque_mirror_ratio(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_torque_mirror_ratio(ptr); break;
+            case 25: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_cam(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_cam(ptr); break;
+            case 26: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_load_encoder_axis(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_load_encoder_axis(ptr); break;
+            case 27: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_input_filter_bandwidth(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_input_filter_bandwidth(ptr); break;
+            case 28: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_anticogging(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_anticogging(ptr); break;
+            case 29: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_mechanical_power_bandwidth(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_mechanical_power_bandwidth(ptr); break;
+            case 30: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_electrical_power_bandwidth(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_electrical_power_bandwidth(ptr); break;
+            case 31: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_spinout_mechanical_power_threshold(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_spinout_mechanical_power_threshold(ptr); break;
+            case 32: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_spinout_electrical_power_threshold(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_spinout_electrical_power_threshold(ptr); break;
+            case 33: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filter0(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filter0(ptr); break;
+            case 34: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filter1(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filter1(ptr); break;
+            case 35: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filter2(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filter2(ptr); break;
+            case 36: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filter3(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filter3(ptr); break;
+            case 37: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filters_on_torque(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filters_on_torque(ptr); break;
+            case 38: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_input_shaper_type(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_input_shaper_type(ptr); break;
+            case 39: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_input_shaper_frequency(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_input_shaper_frequency(ptr); break;
+            case 40: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_input_shaper_damping(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_input_shaper_damping(ptr); break;
+            case 41: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_enable_disturbance_observer(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_enable_disturbance_observer(ptr); break;
+            case 42: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_disturbance_observer_bandwidth(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_disturbance_observer_bandwidth(ptr); break;
+            case 43: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_enable_friction_compensation(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_enable_friction_compensation(ptr); break;
+            case 44: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_friction_coulomb(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_friction_coulomb(ptr); break;
+            case 45: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_friction_stribeck(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_friction_stribeck(ptr); break;
+            case 46: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_friction_stribeck_velocity(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_friction_stribeck_velocity(ptr); break;
+            case 47: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_friction_viscous(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_friction_viscous(ptr); break;
+            case 48: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_friction_zero_vel_band(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_friction_zero_vel_band(ptr); break;
+            case 49: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_pos_gain_table(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_pos_gain_table(ptr); break;
+            case 50: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::get_vel_gain_table(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::get_vel_gain_table(ptr); break;
         }
         return res;
     }
@@ -958,6 +1071,29 @@ struct ODriveControllerConfigAnticoggingTypeInfo : TypeInfo {
     }
 };
 
+template<typename T>
+struct ODriveControllerConfigCamTypeInfo : TypeInfo {
+    using TypeInfo::TypeInfo;
+    static const PropertyInfo property_table[];
+    static const ODriveControllerConfigCamTypeInfo<T> singleton;
+    static Introspectable make_introspectable(T& obj) { return TypeInfo::make_introspectable(&obj, &singleton); }
+
+    introspectable_storage_t get_child(introspectable_storage_t obj, size_t idx) const override {
+        T* ptr = *(T**)&obj;
+        introspectable_storage_t res;
+        switch (idx) {
+            case 0: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_enabled(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_enabled(ptr); break;
+            case 1: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_master_source(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_master_source(ptr); break;
+            case 2: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_master_offset(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_master_offset(ptr); break;
+            case 3: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_master_period(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_master_period(ptr); break;
+            case 4: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_rise(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_rise(ptr); break;
+            case 5: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_num_points(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_num_points(ptr); break;
+            case 6: *(decltype(ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_master_timeout(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_master_timeout(ptr); break;
+        }
+        return res;
+    }
+};
+
 template<typename T>
 struct ODriveControllerAutotuningTypeInfo : TypeInfo {
     using TypeInfo::TypeInfo;
@@ -973,6 +1109,116 @@ struct ODriveControllerAutotuningTypeInfo : TypeInfo {
             case 1: *(decltype(ODriveIntf::ControllerIntf::AutotuningIntf::get_pos_amplitude(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::AutotuningIntf::get_pos_amplitude(ptr); break;
             case 2: *(decltype(ODriveIntf::ControllerIntf::AutotuningIntf::get_vel_amplitude(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::AutotuningIntf::get_vel_amplitude(ptr); break;
             case 3: *(decltype(ODriveIntf::ControllerIntf::AutotuningIntf::get_torque_amplitude(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::AutotuningIntf::get_torque_amplitude(ptr); break;
+            case 4: *(decltype(ODriveIntf::ControllerIntf::AutotuningIntf::get_target_bandwidth(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::AutotuningIntf::get_target_bandwidth(ptr); break;
+            case 5: *(decltype(ODriveIntf::ControllerIntf::AutotuningIntf::get_identification_duration(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::AutotuningIntf::get_identification_duration(ptr); break;
+        }
+        return res;
+    }
+};
+
+template<typename T>
+struct ODriveControllerGainIdentificationTypeInfo : TypeInfo {
+    using TypeInfo::TypeInfo;
+    static const PropertyInfo property_table[];
+    static const ODriveControllerGainIdentificationTypeInfo<T> singleton;
+    static Introspectable make_introspectable(T& obj) { return TypeInfo::make_introspectable(&obj, &singleton); }
+
+    introspectable_storage_t get_child(introspectable_storage_t obj, size_t idx) const override {
+        T* ptr = *(T**)&obj;
+        introspectable_storage_t res;
+        switch (idx) {
+            case 0: *(decltype(ODriveIntf::ControllerIntf::GainIdentificationIntf::get_active(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::GainIdentificationIntf::get_active(ptr); break;
+            case 1: *(decltype(ODriveIntf::ControllerIntf::GainIdentificationIntf::get_valid(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::GainIdentificationIntf::get_valid(ptr); break;
+            case 2: *(decltype(ODriveIntf::ControllerIntf::GainIdentificationIntf::get_inertia(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::GainIdentificationIntf::get_inertia(ptr); break;
+            case 3: *(decltype(ODriveIntf::ControllerIntf::GainIdentificationIntf::get_viscous_friction(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::GainIdentificationIntf::get_viscous_friction(ptr); break;
+            case 4: *(decltype(ODriveIntf::ControllerIntf::GainIdentificationIntf::get_coulomb_friction(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::GainIdentificationIntf::get_coulomb_friction(ptr); break;
+        }
+        return res;
+    }
+};
+
+template<typename T>
+struct ODriveControllerFrequencyResponseTypeInfo : TypeInfo {
+    using TypeInfo::TypeInfo;
+    static const PropertyInfo property_table[];
+    static const ODriveControllerFrequencyResponseTypeInfo<T> singleton;
+    static Introspectable make_introspectable(T& obj) { return TypeInfo::make_introspectable(&obj, &singleton); }
+
+    introspectable_storage_t get_child(introspectable_storage_t obj, size_t idx) const override {
+        T* ptr = *(T**)&obj;
+        introspectable_storage_t res;
+        switch (idx) {
+            case 0: *(decltype(ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_start_frequency(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_start_frequency(ptr); break;
+            case 1: *(decltype(ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_stop_frequency(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_stop_frequency(ptr); break;
+            case 2: *(decltype(ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_num_points(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_num_points(ptr); break;
+            case 3: *(decltype(ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_settle_cycles(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_settle_cycles(ptr); break;
+            case 4: *(decltype(ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_measure_cycles(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_measure_cycles(ptr); break;
+            case 5: *(decltype(ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_loop(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_loop(ptr); break;
+            case 6: *(decltype(ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_active(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_active(ptr); break;
+            case 7: *(decltype(ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_index(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_index(ptr); break;
+        }
+        return res;
+    }
+};
+
+template<typename T>
+struct ODriveControllerVelFilterTypeInfo : TypeInfo {
+    using TypeInfo::TypeInfo;
+    static const PropertyInfo property_table[];
+    static const ODriveControllerVelFilterTypeInfo<T> singleton;
+    static Introspectable make_introspectable(T& obj) { return TypeInfo::make_introspectable(&obj, &singleton); }
+
+    introspectable_storage_t get_child(introspectable_storage_t obj, size_t idx) const override {
+        T* ptr = *(T**)&obj;
+        introspectable_storage_t res;
+        switch (idx) {
+            case 0: *(decltype(ODriveIntf::ControllerIntf::VelFilterIntf::get_type(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::VelFilterIntf::get_type(ptr); break;
+            case 1: *(decltype(ODriveIntf::ControllerIntf::VelFilterIntf::get_frequency(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::VelFilterIntf::get_frequency(ptr); break;
+            case 2: *(decltype(ODriveIntf::ControllerIntf::VelFilterIntf::get_q(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::VelFilterIntf::get_q(ptr); break;
+        }
+        return res;
+    }
+};
+
+template<typename T>
+struct ODriveControllerFrictionCalibrationTypeInfo : TypeInfo {
+    using TypeInfo::TypeInfo;
+    static const PropertyInfo property_table[];
+    static const ODriveControllerFrictionCalibrationTypeInfo<T> singleton;
+    static Introspectable make_introspectable(T& obj) { return TypeInfo::make_introspectable(&obj, &singleton); }
+
+    introspectable_storage_t get_child(introspectable_storage_t obj, size_t idx) const override {
+        T* ptr = *(T**)&obj;
+        introspectable_storage_t res;
+        switch (idx) {
+            case 0: *(decltype(ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_min_vel(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_min_vel(ptr); break;
+            case 1: *(decltype(ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_max_vel(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_max_vel(ptr); break;
+            case 2: *(decltype(ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_num_points(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_num_points(ptr); break;
+            case 3: *(decltype(ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_settle_time(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_settle_time(ptr); break;
+            case 4: *(decltype(ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_measure_time(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_measure_time(ptr); break;
+            case 5: *(decltype(ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_active(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_active(ptr); break;
+            case 6: *(decltype(ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_valid(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_valid(ptr); break;
+            case 7: *(decltype(ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_index(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_index(ptr); break;
+        }
+        return res;
+    }
+};
+
+template<typename T>
+struct ODriveControllerGainTableTypeInfo : TypeInfo {
+    using TypeInfo::TypeInfo;
+    static const PropertyInfo property_table[];
+    static const ODriveControllerGainTableTypeInfo<T> singleton;
+    static Introspectable make_introspectable(T& obj) { return TypeInfo::make_introspectable(&obj, &singleton); }
+
+    introspectable_storage_t get_child(introspectable_storage_t obj, size_t idx) const override {
+        T* ptr = *(T**)&obj;
+        introspectable_storage_t res;
+        switch (idx) {
+            case 0: *(decltype(ODriveIntf::ControllerIntf::GainTableIntf::get_enabled(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::GainTableIntf::get_enabled(ptr); break;
+            case 1: *(decltype(ODriveIntf::ControllerIntf::GainTableIntf::get_min(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::GainTableIntf::get_min(ptr); break;
+            case 2: *(decltype(ODriveIntf::ControllerIntf::GainTableIntf::get_max(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::GainTableIntf::get_max(ptr); break;
+            case 3: *(decltype(ODriveIntf::ControllerIntf::GainTableIntf::get_num_points(std::declval<T*>()))*)(&res) = ODriveIntf::ControllerIntf::GainTableIntf::get_num_points(ptr); break;
         }
         return res;
     }
@@ -1069,6 +1315,7 @@ struct ODriveEndstopConfigTypeInfo : TypeInfo {
             case 2: *(decltype(ODriveIntf::EndstopIntf::ConfigIntf::get_offset(std::declval<T*>()))*)(&res) = ODriveIntf::EndstopIntf::ConfigIntf::get_offset(ptr); break;
             case 3: *(decltype(ODriveIntf::EndstopIntf::ConfigIntf::get_is_active_high(std::declval<T*>()))*)(&res) = ODriveIntf::EndstopIntf::ConfigIntf::get_is_active_high(ptr); break;
             case 4: *(decltype(ODriveIntf::EndstopIntf::ConfigIntf::get_debounce_ms(std::declval<T*>()))*)(&res) = ODriveIntf::EndstopIntf::ConfigIntf::get_debounce_ms(ptr); break;
+            case 5: *(decltype(ODriveIntf::EndstopIntf::ConfigIntf::get_enable_edge_capture(std::declval<T*>()))*)(&res) = ODriveIntf::EndstopIntf::ConfigIntf::get_enable_edge_capture(ptr); break;
         }
         return res;
     }
@@ -1092,6 +1339,62 @@ struct ODriveMechanicalBrakeConfigTypeInfo : TypeInfo {
     }
 };
 
+template<typename T>
+struct ODrivePositionCompareConfigTypeInfo : TypeInfo {
+    using TypeInfo::TypeInfo;
+    static const PropertyInfo property_table[];
+    static const ODrivePositionCompareConfigTypeInfo<T> singleton;
+    static Introspectable make_introspectable(T& obj) { return TypeInfo::make_introspectable(&obj, &singleton); }
+
+    introspectable_storage_t get_child(introspectable_storage_t obj, size_t idx) const override {
+        T* ptr = *(T**)&obj;
+        introspectable_storage_t res;
+        switch (idx) {
+            case 0: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_enabled(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_enabled(ptr); break;
+            case 1: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_gpio_num(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_gpio_num(ptr); break;
+            case 2: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_is_active_high(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_is_active_high(ptr); break;
+            case 3: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_mode(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_mode(ptr); break;
+            case 4: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_interval_start(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_interval_start(ptr); break;
+            case 5: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_interval(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_interval(ptr); break;
+            case 6: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_num_positions(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_num_positions(ptr); break;
+            case 7: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position0(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position0(ptr); break;
+            case 8: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position1(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position1(ptr); break;
+            case 9: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position2(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position2(ptr); break;
+            case 10: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position3(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position3(ptr); break;
+            case 11: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position4(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position4(ptr); break;
+            case 12: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position5(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position5(ptr); break;
+            case 13: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position6(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position6(ptr); break;
+            case 14: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position7(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position7(ptr); break;
+            case 15: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position8(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position8(ptr); break;
+            case 16: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position9(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position9(ptr); break;
+            case 17: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position10(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position10(ptr); break;
+            case 18: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position11(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position11(ptr); break;
+            case 19: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position12(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position12(ptr); break;
+            case 20: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position13(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position13(ptr); break;
+            case 21: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position14(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position14(ptr); break;
+            case 22: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position15(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position15(ptr); break;
+            case 23: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position16(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position16(ptr); break;
+            case 24: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position17(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position17(ptr); break;
+            case 25: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position18(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position18(ptr); break;
+            case 26: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position19(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position19(ptr); break;
+            case 27: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position20(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position20(ptr); break;
+            case 28: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position21(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position21(ptr); break;
+            case 29: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position22(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position22(ptr); break;
+            case 30: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position23(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position23(ptr); break;
+            case 31: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position24(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position24(ptr); break;
+            case 32: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position25(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position25(ptr); break;
+            case 33: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position26(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position26(ptr); break;
+            case 34: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position27(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position27(ptr); break;
+            case 35: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position28(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position28(ptr); break;
+            case 36: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position29(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position29(ptr); break;
+            case 37: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position30(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position30(ptr); break;
+            case 38: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_position31(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_position31(ptr); break;
+            case 39: *(decltype(ODriveIntf::PositionCompareIntf::ConfigIntf::get_pulse_width(std::declval<T*>()))*)(&res) = ODriveIntf::PositionCompareIntf::ConfigIntf::get_pulse_width(ptr); break;
+        }
+        return res;
+    }
+};
+
 template<typename T>
 struct ODrive3ConfigTypeInfo : TypeInfo {
     using TypeInfo::TypeInfo;
@@ -1128,26 +1431,29 @@ struct ODrive3ConfigTypeInfo : TypeInfo {
             case 22: *(decltype(ODrive3Intf::ConfigIntf::get_error_gpio_pin(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_error_gpio_pin(ptr); break;
             case 23: *(decltype(ODrive3Intf::ConfigIntf::get_gpio3_analog_mapping(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio3_analog_mapping(ptr); break;
             case 24: *(decltype(ODrive3Intf::ConfigIntf::get_gpio4_analog_mapping(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio4_analog_mapping(ptr); break;
-            case 25: *(decltype(ODrive3Intf::ConfigIntf::get_gpio1_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio1_mode(ptr); break;
-            case 26: *(decltype(ODrive3Intf::ConfigIntf::get_gpio2_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio2_mode(ptr); break;
-            case 27: *(decltype(ODrive3Intf::ConfigIntf::get_gpio3_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio3_mode(ptr); break;
-            case 28: *(decltype(ODrive3Intf::ConfigIntf::get_gpio4_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio4_mode(ptr); break;
-            case 29: *(decltype(ODrive3Intf::ConfigIntf::get_gpio5_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio5_mode(ptr); break;
-            case 30: *(decltype(ODrive3Intf::ConfigIntf::get_gpio6_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio6_mode(ptr); break;
-            case 31: *(decltype(ODrive3Intf::ConfigIntf::get_gpio7_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio7_mode(ptr); break;
-            case 32: *(decltype(ODrive3Intf::ConfigIntf::get_gpio8_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio8_mode(ptr); break;
-            case 33: *(decltype(ODrive3Intf::ConfigIntf::get_gpio9_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio9_mode(ptr); break;
-            case 34: *(decltype(ODrive3Intf::ConfigIntf::get_gpio10_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio10_mode(ptr); break;
-            case 35: *(decltype(ODrive3Intf::ConfigIntf::get_gpio11_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio11_mode(ptr); break;
-            case 36: *(decltype(ODrive3Intf::ConfigIntf::get_gpio12_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio12_mode(ptr); break;
-            case 37: *(decltype(ODrive3Intf::ConfigIntf::get_gpio13_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio13_mode(ptr); break;
-            case 38: *(decltype(ODrive3Intf::ConfigIntf::get_gpio14_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio14_mode(ptr); break;
-            case 39: *(decltype(ODrive3Intf::ConfigIntf::get_gpio15_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio15_mode(ptr); break;
-            case 40: *(decltype(ODrive3Intf::ConfigIntf::get_gpio16_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio16_mode(ptr); break;
-            case 41: *(decltype(ODrive3Intf::ConfigIntf::get_gpio1_pwm_mapping(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio1_pwm_mapping(ptr); break;
-            case 42: *(decltype(ODrive3Intf::ConfigIntf::get_gpio2_pwm_mapping(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio2_pwm_mapping(ptr); break;
-            case 43: *(decltype(ODrive3Intf::ConfigIntf::get_gpio3_pwm_mapping(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio3_pwm_mapping(ptr); break;
-            case 44: *(decltype(ODrive3Intf::ConfigIntf::get_gpio4_pwm_mapping(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio4_pwm_mapping(ptr); break;
+            case 25: *(decltype(ODrive3Intf::ConfigIntf::get_kinematics(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_kinematics(ptr); break;
+            case 26: *(decltype(ODrive3Intf::ConfigIntf::get_motion_queue(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_motion_queue(ptr); break;
+            case 27: *(decltype(ODrive3Intf::ConfigIntf::get_enable_double_pwm_update(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_enable_double_pwm_update(ptr); break;
+            case 28: *(decltype(ODrive3Intf::ConfigIntf::get_gpio1_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio1_mode(ptr); break;
+            case 29: *(decltype(ODrive3Intf::ConfigIntf::get_gpio2_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio2_mode(ptr); break;
+            case 30: *(decltype(ODrive3Intf::ConfigIntf::get_gpio3_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio3_mode(ptr); break;
+            case 31: *(decltype(ODrive3Intf::ConfigIntf::get_gpio4_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio4_mode(ptr); break;
+            case 32: *(decltype(ODrive3Intf::ConfigIntf::get_gpio5_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio5_mode(ptr); break;
+            case 33: *(decltype(ODrive3Intf::ConfigIntf::get_gpio6_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio6_mode(ptr); break;
+            case 34: *(decltype(ODrive3Intf::ConfigIntf::get_gpio7_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio7_mode(ptr); break;
+            case 35: *(decltype(ODrive3Intf::ConfigIntf::get_gpio8_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio8_mode(ptr); break;
+            case 36: *(decltype(ODrive3Intf::ConfigIntf::get_gpio9_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio9_mode(ptr); break;
+            case 37: *(decltype(ODrive3Intf::ConfigIntf::get_gpio10_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio10_mode(ptr); break;
+            case 38: *(decltype(ODrive3Intf::ConfigIntf::get_gpio11_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio11_mode(ptr); break;
+            case 39: *(decltype(ODrive3Intf::ConfigIntf::get_gpio12_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio12_mode(ptr); break;
+            case 40: *(decltype(ODrive3Intf::ConfigIntf::get_gpio13_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio13_mode(ptr); break;
+            case 41: *(decltype(ODrive3Intf::ConfigIntf::get_gpio14_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio14_mode(ptr); break;
+            case 42: *(decltype(ODrive3Intf::ConfigIntf::get_gpio15_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio15_mode(ptr); break;
+            case 43: *(decltype(ODrive3Intf::ConfigIntf::get_gpio16_mode(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio16_mode(ptr); break;
+            case 44: *(decltype(ODrive3Intf::ConfigIntf::get_gpio1_pwm_mapping(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio1_pwm_mapping(ptr); break;
+            case 45: *(decltype(ODrive3Intf::ConfigIntf::get_gpio2_pwm_mapping(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio2_pwm_mapping(ptr); break;
+            case 46: *(decltype(ODrive3Intf::ConfigIntf::get_gpio3_pwm_mapping(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio3_pwm_mapping(ptr); break;
+            case 47: *(decltype(ODrive3Intf::ConfigIntf::get_gpio4_pwm_mapping(std::declval<T*>()))*)(&res) = ODrive3Intf::ConfigIntf::get_gpio4_pwm_mapping(ptr); break;
         }
         return res;
     }
@@ -1215,6 +1521,9 @@ const PropertyInfo ODriveConfigTypeInfo<T>::property_table[] = {
     {"error_gpio_pin", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ConfigIntf::get_error_gpio_pin(std::declval<T*>()))>>::singleton},
     {"gpio3_analog_mapping", &ODriveEndpointTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ConfigIntf::get_gpio3_analog_mapping(std::declval<T*>()))>>::singleton},
     {"gpio4_analog_mapping", &ODriveEndpointTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ConfigIntf::get_gpio4_analog_mapping(std::declval<T*>()))>>::singleton},
+    {"kinematics", &ODriveConfigKinematicsTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ConfigIntf::get_kinematics(std::declval<T*>()))>>::singleton},
+    {"motion_queue", &ODriveConfigMotionQueueTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ConfigIntf::get_motion_queue(std::declval<T*>()))>>::singleton},
+    {"enable_double_pwm_update", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ConfigIntf::get_enable_double_pwm_update(std::declval<T*>()))>>::singleton},
 };
 template<typename T>
 const ODriveConfigTypeInfo<T> ODriveConfigTypeInfo<T>::singleton{ODriveConfigTypeInfo<T>::property_table, sizeof(ODriveConfigTypeInfo<T>::property_table) / sizeof(ODriveConfigTypeInfo<T>::property_table[0])};
@@ -1257,7 +1566,9 @@ const PropertyInfo ODriveAxisTypeInfo<T>::property_table[] = {
     {"trap_traj", &ODriveTrapezoidalTrajectoryTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::AxisIntf::get_trap_traj(std::declval<T*>()))>>::singleton},
     {"min_endstop", &ODriveEndstopTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::AxisIntf::get_min_endstop(std::declval<T*>()))>>::singleton},
     {"max_endstop", &ODriveEndstopTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::AxisIntf::get_max_endstop(std::declval<T*>()))>>::singleton},
+    {"probe", &ODriveEndstopTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::AxisIntf::get_probe(std::declval<T*>()))>>::singleton},
     {"mechanical_brake", &ODriveMechanicalBrakeTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::AxisIntf::get_mechanical_brake(std::declval<T*>()))>>::singleton},
+    {"position_compare", &ODrivePositionCompareTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::AxisIntf::get_position_compare(std::declval<T*>()))>>::singleton},
     {"task_times", &ODriveAxisTaskTimesTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::AxisIntf::get_task_times(std::declval<T*>()))>>::singleton},
 };
 template<typename T>
@@ -1339,6 +1650,7 @@ const PropertyInfo ODriveMotorTypeInfo<T>::property_table[] = {
     {"I_bus", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::get_I_bus(std::declval<T*>()))>>::singleton},
     {"phase_current_rev_gain", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::get_phase_current_rev_gain(std::declval<T*>()))>>::singleton},
     {"effective_current_lim", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::get_effective_current_lim(std::declval<T*>()))>>::singleton},
+    {"field_weakening_id", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::get_field_weakening_id(std::declval<T*>()))>>::singleton},
     {"max_allowed_current", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::get_max_allowed_current(std::declval<T*>()))>>::singleton},
     {"max_dc_calib", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::get_max_dc_calib(std::declval<T*>()))>>::singleton},
     {"fet_thermistor", &ODriveOnboardThermistorCurrentLimiterTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::get_fet_thermistor(std::declval<T*>()))>>::singleton},
@@ -1391,6 +1703,10 @@ const PropertyInfo ODriveControllerTypeInfo<T>::property_table[] = {
     {"autotuning", &ODriveControllerAutotuningTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::get_autotuning(std::declval<T*>()))>>::singleton},
     {"mechanical_power", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::get_mechanical_power(std::declval<T*>()))>>::singleton},
     {"electrical_power", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::get_electrical_power(std::declval<T*>()))>>::singleton},
+    {"gain_identification", &ODriveControllerGainIdentificationTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::get_gain_identification(std::declval<T*>()))>>::singleton},
+    {"frequency_response", &ODriveControllerFrequencyResponseTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::get_frequency_response(std::declval<T*>()))>>::singleton},
+    {"load_torque_estimate", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::get_load_torque_estimate(std::declval<T*>()))>>::singleton},
+    {"friction_calibration", &ODriveControllerFrictionCalibrationTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::get_friction_calibration(std::declval<T*>()))>>::singleton},
 };
 template<typename T>
 const ODriveControllerTypeInfo<T> ODriveControllerTypeInfo<T>::singleton{ODriveControllerTypeInfo<T>::property_table, sizeof(ODriveControllerTypeInfo<T>::property_table) / sizeof(ODriveControllerTypeInfo<T>::property_table[0])};
@@ -1447,6 +1763,9 @@ template<typename T>
 const PropertyInfo ODriveEndstopTypeInfo<T>::property_table[] = {
     {"endstop_state", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::EndstopIntf::get_endstop_state(std::declval<T*>()))>>::singleton},
     {"config", &ODriveEndstopConfigTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::EndstopIntf::get_config(std::declval<T*>()))>>::singleton},
+    {"latched", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::EndstopIntf::get_latched(std::declval<T*>()))>>::singleton},
+    {"latch_pos", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::EndstopIntf::get_latch_pos(std::declval<T*>()))>>::singleton},
+    {"edge_capture", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::EndstopIntf::get_edge_capture(std::declval<T*>()))>>::singleton},
 };
 template<typename T>
 const ODriveEndstopTypeInfo<T> ODriveEndstopTypeInfo<T>::singleton{ODriveEndstopTypeInfo<T>::property_table, sizeof(ODriveEndstopTypeInfo<T>::property_table) / sizeof(ODriveEndstopTypeInfo<T>::property_table[0])};
@@ -1460,6 +1779,19 @@ template<typename T>
 const ODriveMechanicalBrakeTypeInfo<T> ODriveMechanicalBrakeTypeInfo<T>::singleton{ODriveMechanicalBrakeTypeInfo<T>::property_table, sizeof(ODriveMechanicalBrakeTypeInfo<T>::property_table) / sizeof(ODriveMechanicalBrakeTypeInfo<T>::property_table[0])};
 
 
+template<typename T>
+const PropertyInfo ODrivePositionCompareTypeInfo<T>::property_table[] = {
+    {"trigger_count", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::get_trigger_count(std::declval<T*>()))>>::singleton},
+    {"last_trigger_pos", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::get_last_trigger_pos(std::declval<T*>()))>>::singleton},
+    {"last_trigger_tick", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::get_last_trigger_tick(std::declval<T*>()))>>::singleton},
+    {"last_trigger_offset", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::get_last_trigger_offset(std::declval<T*>()))>>::singleton},
+    {"tick_count", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::get_tick_count(std::declval<T*>()))>>::singleton},
+    {"config", &ODrivePositionCompareConfigTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::get_config(std::declval<T*>()))>>::singleton},
+};
+template<typename T>
+const ODrivePositionCompareTypeInfo<T> ODrivePositionCompareTypeInfo<T>::singleton{ODrivePositionCompareTypeInfo<T>::property_table, sizeof(ODrivePositionCompareTypeInfo<T>::property_table) / sizeof(ODrivePositionCompareTypeInfo<T>::property_table[0])};
+
+
 template<typename T>
 const PropertyInfo ODriveTaskTimerTypeInfo<T>::property_table[] = {
     {"start_time", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::TaskTimerIntf::get_start_time(std::declval<T*>()))>>::singleton},
@@ -1568,6 +1900,28 @@ template<typename T>
 const ODriveSystemStatsI2CTypeInfo<T> ODriveSystemStatsI2CTypeInfo<T>::singleton{ODriveSystemStatsI2CTypeInfo<T>::property_table, sizeof(ODriveSystemStatsI2CTypeInfo<T>::property_table) / sizeof(ODriveSystemStatsI2CTypeInfo<T>::property_table[0])};
 
 
+template<typename T>
+const PropertyInfo ODriveConfigKinematicsTypeInfo<T>::property_table[] = {
+    {"type", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ConfigIntf::KinematicsIntf::get_type(std::declval<T*>()))>>::singleton},
+    {"scale", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ConfigIntf::KinematicsIntf::get_scale(std::declval<T*>()))>>::singleton},
+    {"matrix0", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ConfigIntf::KinematicsIntf::get_matrix0(std::declval<T*>()))>>::singleton},
+    {"matrix1", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ConfigIntf::KinematicsIntf::get_matrix1(std::declval<T*>()))>>::singleton},
+    {"matrix2", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ConfigIntf::KinematicsIntf::get_matrix2(std::declval<T*>()))>>::singleton},
+    {"matrix3", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ConfigIntf::KinematicsIntf::get_matrix3(std::declval<T*>()))>>::singleton},
+};
+template<typename T>
+const ODriveConfigKinematicsTypeInfo<T> ODriveConfigKinematicsTypeInfo<T>::singleton{ODriveConfigKinematicsTypeInfo<T>::property_table, sizeof(ODriveConfigKinematicsTypeInfo<T>::property_table) / sizeof(ODriveConfigKinematicsTypeInfo<T>::property_table[0])};
+
+
+template<typename T>
+const PropertyInfo ODriveConfigMotionQueueTypeInfo<T>::property_table[] = {
+    {"accel_limit", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ConfigIntf::MotionQueueIntf::get_accel_limit(std::declval<T*>()))>>::singleton},
+    {"rapid_rate", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ConfigIntf::MotionQueueIntf::get_rapid_rate(std::declval<T*>()))>>::singleton},
+};
+template<typename T>
+const ODriveConfigMotionQueueTypeInfo<T> ODriveConfigMotionQueueTypeInfo<T>::singleton{ODriveConfigMotionQueueTypeInfo<T>::property_table, sizeof(ODriveConfigMotionQueueTypeInfo<T>::property_table) / sizeof(ODriveConfigMotionQueueTypeInfo<T>::property_table[0])};
+
+
 template<typename T>
 const PropertyInfo ODriveCanConfigTypeInfo<T>::property_table[] = {
     {"baud_rate", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::CanIntf::ConfigIntf::get_baud_rate(std::declval<T*>()))>>::singleton},
@@ -1688,6 +2042,7 @@ const PropertyInfo ODriveMotorConfigTypeInfo<T>::property_table[] = {
     {"pole_pairs", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_pole_pairs(std::declval<T*>()))>>::singleton},
     {"calibration_current", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_calibration_current(std::declval<T*>()))>>::singleton},
     {"resistance_calib_max_voltage", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_resistance_calib_max_voltage(std::declval<T*>()))>>::singleton},
+    {"calibration_tolerance", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_calibration_tolerance(std::declval<T*>()))>>::singleton},
     {"phase_inductance", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_phase_inductance(std::declval<T*>()))>>::singleton},
     {"phase_resistance", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_phase_resistance(std::declval<T*>()))>>::singleton},
     {"torque_constant", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_torque_constant(std::declval<T*>()))>>::singleton},
@@ -1710,6 +2065,22 @@ const PropertyInfo ODriveMotorConfigTypeInfo<T>::property_table[] = {
     {"I_bus_hard_max", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_I_bus_hard_max(std::declval<T*>()))>>::singleton},
     {"I_leak_max", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_I_leak_max(std::declval<T*>()))>>::singleton},
     {"dc_calib_tau", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_dc_calib_tau(std::declval<T*>()))>>::singleton},
+    {"max_modulation", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_max_modulation(std::declval<T*>()))>>::singleton},
+    {"enable_overmodulation", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_enable_overmodulation(std::declval<T*>()))>>::singleton},
+    {"enable_field_weakening", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_enable_field_weakening(std::declval<T*>()))>>::singleton},
+    {"field_weakening_modulation", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_field_weakening_modulation(std::declval<T*>()))>>::singleton},
+    {"field_weakening_gain", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_field_weakening_gain(std::declval<T*>()))>>::singleton},
+    {"field_weakening_max_current", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_field_weakening_max_current(std::declval<T*>()))>>::singleton},
+    {"enable_mtpa", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_enable_mtpa(std::declval<T*>()))>>::singleton},
+    {"phase_inductance_d", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_phase_inductance_d(std::declval<T*>()))>>::singleton},
+    {"phase_inductance_q", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_phase_inductance_q(std::declval<T*>()))>>::singleton},
+    {"enable_complex_vector_current_control", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_enable_complex_vector_current_control(std::declval<T*>()))>>::singleton},
+    {"enable_dead_time_comp", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_enable_dead_time_comp(std::declval<T*>()))>>::singleton},
+    {"dead_time_comp_time", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_dead_time_comp_time(std::declval<T*>()))>>::singleton},
+    {"dead_time_comp_voltage", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_dead_time_comp_voltage(std::declval<T*>()))>>::singleton},
+    {"dead_time_comp_current_band", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_dead_time_comp_current_band(std::declval<T*>()))>>::singleton},
+    {"enable_deadbeat_current_control", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_enable_deadbeat_current_control(std::declval<T*>()))>>::singleton},
+    {"deadbeat_gain", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::MotorIntf::ConfigIntf::get_deadbeat_gain(std::declval<T*>()))>>::singleton},
 };
 template<typename T>
 const ODriveMotorConfigTypeInfo<T> ODriveMotorConfigTypeInfo<T>::singleton{ODriveMotorConfigTypeInfo<T>::property_table, sizeof(ODriveMotorConfigTypeInfo<T>::property_table) / sizeof(ODriveMotorConfigTypeInfo<T>::property_table[0])};
@@ -1744,10 +2115,13 @@ const PropertyInfo ODriveControllerConfigTypeInfo<T>::property_table[] = {
     {"circular_setpoint_range", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_circular_setpoint_range(std::declval<T*>()))>>::singleton},
     {"steps_per_circular_range", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_steps_per_circular_range(std::declval<T*>()))>>::singleton},
     {"homing_speed", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_homing_speed(std::declval<T*>()))>>::singleton},
+    {"homing_fast_speed", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_homing_fast_speed(std::declval<T*>()))>>::singleton},
+    {"homing_backoff_distance", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_homing_backoff_distance(std::declval<T*>()))>>::singleton},
     {"inertia", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_inertia(std::declval<T*>()))>>::singleton},
     {"axis_to_mirror", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_axis_to_mirror(std::declval<T*>()))>>::singleton},
     {"mirror_ratio", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_mirror_ratio(std::declval<T*>()))>>::singleton},
     {"torque_mirror_ratio", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_torque_mirror_ratio(std::declval<T*>()))>>::singleton},
+    {"cam", &ODriveControllerConfigCamTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_cam(std::declval<T*>()))>>::singleton},
     {"load_encoder_axis", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_load_encoder_axis(std::declval<T*>()))>>::singleton},
     {"input_filter_bandwidth", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_input_filter_bandwidth(std::declval<T*>()))>>::singleton},
     {"anticogging", &ODriveControllerConfigAnticoggingTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_anticogging(std::declval<T*>()))>>::singleton},
@@ -1755,6 +2129,24 @@ const PropertyInfo ODriveControllerConfigTypeInfo<T>::property_table[] = {
     {"electrical_power_bandwidth", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_electrical_power_bandwidth(std::declval<T*>()))>>::singleton},
     {"spinout_mechanical_power_threshold", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_spinout_mechanical_power_threshold(std::declval<T*>()))>>::singleton},
     {"spinout_electrical_power_threshold", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_spinout_electrical_power_threshold(std::declval<T*>()))>>::singleton},
+    {"vel_filter0", &ODriveControllerVelFilterTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filter0(std::declval<T*>()))>>::singleton},
+    {"vel_filter1", &ODriveControllerVelFilterTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filter1(std::declval<T*>()))>>::singleton},
+    {"vel_filter2", &ODriveControllerVelFilterTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filter2(std::declval<T*>()))>>::singleton},
+    {"vel_filter3", &ODriveControllerVelFilterTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filter3(std::declval<T*>()))>>::singleton},
+    {"vel_filters_on_torque", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_vel_filters_on_torque(std::declval<T*>()))>>::singleton},
+    {"input_shaper_type", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_input_shaper_type(std::declval<T*>()))>>::singleton},
+    {"input_shaper_frequency", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_input_shaper_frequency(std::declval<T*>()))>>::singleton},
+    {"input_shaper_damping", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_input_shaper_damping(std::declval<T*>()))>>::singleton},
+    {"enable_disturbance_observer", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_enable_disturbance_observer(std::declval<T*>()))>>::singleton},
+    {"disturbance_observer_bandwidth", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_disturbance_observer_bandwidth(std::declval<T*>()))>>::singleton},
+    {"enable_friction_compensation", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_enable_friction_compensation(std::declval<T*>()))>>::singleton},
+    {"friction_coulomb", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_friction_coulomb(std::declval<T*>()))>>::singleton},
+    {"friction_stribeck", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_friction_stribeck(std::declval<T*>()))>>::singleton},
+    {"friction_stribeck_velocity", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_friction_stribeck_velocity(std::declval<T*>()))>>::singleton},
+    {"friction_viscous", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_friction_viscous(std::declval<T*>()))>>::singleton},
+    {"friction_zero_vel_band", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_friction_zero_vel_band(std::declval<T*>()))>>::singleton},
+    {"pos_gain_table", &ODriveControllerGainTableTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_pos_gain_table(std::declval<T*>()))>>::singleton},
+    {"vel_gain_table", &ODriveControllerGainTableTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::get_vel_gain_table(std::declval<T*>()))>>::singleton},
 };
 template<typename T>
 const ODriveControllerConfigTypeInfo<T> ODriveControllerConfigTypeInfo<T>::singleton{ODriveControllerConfigTypeInfo<T>::property_table, sizeof(ODriveControllerConfigTypeInfo<T>::property_table) / sizeof(ODriveControllerConfigTypeInfo<T>::property_table[0])};
@@ -1774,17 +2166,96 @@ template<typename T>
 const ODriveControllerConfigAnticoggingTypeInfo<T> ODriveControllerConfigAnticoggingTypeInfo<T>::singleton{ODriveControllerConfigAnticoggingTypeInfo<T>::property_table, sizeof(ODriveControllerConfigAnticoggingTypeInfo<T>::property_table) / sizeof(ODriveControllerConfigAnticoggingTypeInfo<T>::property_table[0])};
 
 
+template<typename T>
+const PropertyInfo ODriveControllerConfigCamTypeInfo<T>::property_table[] = {
+    {"enabled", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_enabled(std::declval<T*>()))>>::singleton},
+    {"master_source", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_master_source(std::declval<T*>()))>>::singleton},
+    {"master_offset", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_master_offset(std::declval<T*>()))>>::singleton},
+    {"master_period", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_master_period(std::declval<T*>()))>>::singleton},
+    {"rise", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_rise(std::declval<T*>()))>>::singleton},
+    {"num_points", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_num_points(std::declval<T*>()))>>::singleton},
+    {"master_timeout", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::ConfigIntf::CamIntf::get_master_timeout(std::declval<T*>()))>>::singleton},
+};
+template<typename T>
+const ODriveControllerConfigCamTypeInfo<T> ODriveControllerConfigCamTypeInfo<T>::singleton{ODriveControllerConfigCamTypeInfo<T>::property_table, sizeof(ODriveControllerConfigCamTypeInfo<T>::property_table) / sizeof(ODriveControllerConfigCamTypeInfo<T>::property_table[0])};
+
+
 template<typename T>
 const PropertyInfo ODriveControllerAutotuningTypeInfo<T>::property_table[] = {
     {"frequency", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::AutotuningIntf::get_frequency(std::declval<T*>()))>>::singleton},
     {"pos_amplitude", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::AutotuningIntf::get_pos_amplitude(std::declval<T*>()))>>::singleton},
     {"vel_amplitude", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::AutotuningIntf::get_vel_amplitude(std::declval<T*>()))>>::singleton},
     {"torque_amplitude", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::AutotuningIntf::get_torque_amplitude(std::declval<T*>()))>>::singleton},
+    {"target_bandwidth", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::AutotuningIntf::get_target_bandwidth(std::declval<T*>()))>>::singleton},
+    {"identification_duration", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::AutotuningIntf::get_identification_duration(std::declval<T*>()))>>::singleton},
 };
 template<typename T>
 const ODriveControllerAutotuningTypeInfo<T> ODriveControllerAutotuningTypeInfo<T>::singleton{ODriveControllerAutotuningTypeInfo<T>::property_table, sizeof(ODriveControllerAutotuningTypeInfo<T>::property_table) / sizeof(ODriveControllerAutotuningTypeInfo<T>::property_table[0])};
 
 
+template<typename T>
+const PropertyInfo ODriveControllerGainIdentificationTypeInfo<T>::property_table[] = {
+    {"active", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::GainIdentificationIntf::get_active(std::declval<T*>()))>>::singleton},
+    {"valid", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::GainIdentificationIntf::get_valid(std::declval<T*>()))>>::singleton},
+    {"inertia", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::GainIdentificationIntf::get_inertia(std::declval<T*>()))>>::singleton},
+    {"viscous_friction", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::GainIdentificationIntf::get_viscous_friction(std::declval<T*>()))>>::singleton},
+    {"coulomb_friction", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::GainIdentificationIntf::get_coulomb_friction(std::declval<T*>()))>>::singleton},
+};
+template<typename T>
+const ODriveControllerGainIdentificationTypeInfo<T> ODriveControllerGainIdentificationTypeInfo<T>::singleton{ODriveControllerGainIdentificationTypeInfo<T>::property_table, sizeof(ODriveControllerGainIdentificationTypeInfo<T>::property_table) / sizeof(ODriveControllerGainIdentificationTypeInfo<T>::property_table[0])};
+
+
+template<typename T>
+const PropertyInfo ODriveControllerFrequencyResponseTypeInfo<T>::property_table[] = {
+    {"start_frequency", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_start_frequency(std::declval<T*>()))>>::singleton},
+    {"stop_frequency", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_stop_frequency(std::declval<T*>()))>>::singleton},
+    {"num_points", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_num_points(std::declval<T*>()))>>::singleton},
+    {"settle_cycles", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_settle_cycles(std::declval<T*>()))>>::singleton},
+    {"measure_cycles", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_measure_cycles(std::declval<T*>()))>>::singleton},
+    {"loop", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_loop(std::declval<T*>()))>>::singleton},
+    {"active", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_active(std::declval<T*>()))>>::singleton},
+    {"index", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrequencyResponseIntf::get_index(std::declval<T*>()))>>::singleton},
+};
+template<typename T>
+const ODriveControllerFrequencyResponseTypeInfo<T> ODriveControllerFrequencyResponseTypeInfo<T>::singleton{ODriveControllerFrequencyResponseTypeInfo<T>::property_table, sizeof(ODriveControllerFrequencyResponseTypeInfo<T>::property_table) / sizeof(ODriveControllerFrequencyResponseTypeInfo<T>::property_table[0])};
+
+
+template<typename T>
+const PropertyInfo ODriveControllerVelFilterTypeInfo<T>::property_table[] = {
+    {"type", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::VelFilterIntf::get_type(std::declval<T*>()))>>::singleton},
+    {"frequency", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::VelFilterIntf::get_frequency(std::declval<T*>()))>>::singleton},
+    {"q", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::VelFilterIntf::get_q(std::declval<T*>()))>>::singleton},
+};
+template<typename T>
+const ODriveControllerVelFilterTypeInfo<T> ODriveControllerVelFilterTypeInfo<T>::singleton{ODriveControllerVelFilterTypeInfo<T>::property_table, sizeof(ODriveControllerVelFilterTypeInfo<T>::property_table) / sizeof(ODriveControllerVelFilterTypeInfo<T>::property_table[0])};
+
+
+template<typename T>
+const PropertyInfo ODriveControllerFrictionCalibrationTypeInfo<T>::property_table[] = {
+    {"min_vel", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_min_vel(std::declval<T*>()))>>::singleton},
+    {"max_vel", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_max_vel(std::declval<T*>()))>>::singleton},
+    {"num_points", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_num_points(std::declval<T*>()))>>::singleton},
+    {"settle_time", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_settle_time(std::declval<T*>()))>>::singleton},
+    {"measure_time", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_measure_time(std::declval<T*>()))>>::singleton},
+    {"active", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_active(std::declval<T*>()))>>::singleton},
+    {"valid", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_valid(std::declval<T*>()))>>::singleton},
+    {"index", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::FrictionCalibrationIntf::get_index(std::declval<T*>()))>>::singleton},
+};
+template<typename T>
+const ODriveControllerFrictionCalibrationTypeInfo<T> ODriveControllerFrictionCalibrationTypeInfo<T>::singleton{ODriveControllerFrictionCalibrationTypeInfo<T>::property_table, sizeof(ODriveControllerFrictionCalibrationTypeInfo<T>::property_table) / sizeof(ODriveControllerFrictionCalibrationTypeInfo<T>::property_table[0])};
+
+
+template<typename T>
+const PropertyInfo ODriveControllerGainTableTypeInfo<T>::property_table[] = {
+    {"enabled", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::GainTableIntf::get_enabled(std::declval<T*>()))>>::singleton},
+    {"min", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::GainTableIntf::get_min(std::declval<T*>()))>>::singleton},
+    {"max", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::GainTableIntf::get_max(std::declval<T*>()))>>::singleton},
+    {"num_points", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::ControllerIntf::GainTableIntf::get_num_points(std::declval<T*>()))>>::singleton},
+};
+template<typename T>
+const ODriveControllerGainTableTypeInfo<T> ODriveControllerGainTableTypeInfo<T>::singleton{ODriveControllerGainTableTypeInfo<T>::property_table, sizeof(ODriveControllerGainTableTypeInfo<T>::property_table) / sizeof(ODriveControllerGainTableTypeInfo<T>::property_table[0])};
+
+
 template<typename T>
 const PropertyInfo ODriveEncoderConfigTypeInfo<T>::property_table[] = {
     {"mode", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::EncoderIntf::ConfigIntf::get_mode(std::declval<T*>()))>>::singleton},
@@ -1840,6 +2311,7 @@ const PropertyInfo ODriveEndstopConfigTypeInfo<T>::property_table[] = {
     {"offset", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::EndstopIntf::ConfigIntf::get_offset(std::declval<T*>()))>>::singleton},
     {"is_active_high", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::EndstopIntf::ConfigIntf::get_is_active_high(std::declval<T*>()))>>::singleton},
     {"debounce_ms", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::EndstopIntf::ConfigIntf::get_debounce_ms(std::declval<T*>()))>>::singleton},
+    {"enable_edge_capture", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::EndstopIntf::ConfigIntf::get_enable_edge_capture(std::declval<T*>()))>>::singleton},
 };
 template<typename T>
 const ODriveEndstopConfigTypeInfo<T> ODriveEndstopConfigTypeInfo<T>::singleton{ODriveEndstopConfigTypeInfo<T>::property_table, sizeof(ODriveEndstopConfigTypeInfo<T>::property_table) / sizeof(ODriveEndstopConfigTypeInfo<T>::property_table[0])};
@@ -1854,6 +2326,53 @@ template<typename T>
 const ODriveMechanicalBrakeConfigTypeInfo<T> ODriveMechanicalBrakeConfigTypeInfo<T>::singleton{ODriveMechanicalBrakeConfigTypeInfo<T>::property_table, sizeof(ODriveMechanicalBrakeConfigTypeInfo<T>::property_table) / sizeof(ODriveMechanicalBrakeConfigTypeInfo<T>::property_table[0])};
 
 
+template<typename T>
+const PropertyInfo ODrivePositionCompareConfigTypeInfo<T>::property_table[] = {
+    {"enabled", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_enabled(std::declval<T*>()))>>::singleton},
+    {"gpio_num", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_gpio_num(std::declval<T*>()))>>::singleton},
+    {"is_active_high", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_is_active_high(std::declval<T*>()))>>::singleton},
+    {"mode", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_mode(std::declval<T*>()))>>::singleton},
+    {"interval_start", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_interval_start(std::declval<T*>()))>>::singleton},
+    {"interval", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_interval(std::declval<T*>()))>>::singleton},
+    {"num_positions", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_num_positions(std::declval<T*>()))>>::singleton},
+    {"position0", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position0(std::declval<T*>()))>>::singleton},
+    {"position1", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position1(std::declval<T*>()))>>::singleton},
+    {"position2", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position2(std::declval<T*>()))>>::singleton},
+    {"position3", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position3(std::declval<T*>()))>>::singleton},
+    {"position4", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position4(std::declval<T*>()))>>::singleton},
+    {"position5", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position5(std::declval<T*>()))>>::singleton},
+    {"position6", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position6(std::declval<T*>()))>>::singleton},
+    {"position7", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position7(std::declval<T*>()))>>::singleton},
+    {"position8", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position8(std::declval<T*>()))>>::singleton},
+    {"position9", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position9(std::declval<T*>()))>>::singleton},
+    {"position10", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position10(std::declval<T*>()))>>::singleton},
+    {"position11", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position11(std::declval<T*>()))>>::singleton},
+    {"position12", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position12(std::declval<T*>()))>>::singleton},
+    {"position13", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position13(std::declval<T*>()))>>::singleton},
+    {"position14", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position14(std::declval<T*>()))>>::singleton},
+    {"position15", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position15(std::declval<T*>()))>>::singleton},
+    {"position16", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position16(std::declval<T*>()))>>::singleton},
+    {"position17", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position17(std::declval<T*>()))>>::singleton},
+    {"position18", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position18(std::declval<T*>()))>>::singleton},
+    {"position19", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position19(std::declval<T*>()))>>::singleton},
+    {"position20", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position20(std::declval<T*>()))>>::singleton},
+    {"position21", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position21(std::declval<T*>()))>>::singleton},
+    {"position22", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position22(std::declval<T*>()))>>::singleton},
+    {"position23", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position23(std::declval<T*>()))>>::singleton},
+    {"position24", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position24(std::declval<T*>()))>>::singleton},
+    {"position25", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position25(std::declval<T*>()))>>::singleton},
+    {"position26", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position26(std::declval<T*>()))>>::singleton},
+    {"position27", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position27(std::declval<T*>()))>>::singleton},
+    {"position28", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position28(std::declval<T*>()))>>::singleton},
+    {"position29", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position29(std::declval<T*>()))>>::singleton},
+    {"position30", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position30(std::declval<T*>()))>>::singleton},
+    {"position31", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_position31(std::declval<T*>()))>>::singleton},
+    {"pulse_width", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODriveIntf::PositionCompareIntf::ConfigIntf::get_pulse_width(std::declval<T*>()))>>::singleton},
+};
+template<typename T>
+const ODrivePositionCompareConfigTypeInfo<T> ODrivePositionCompareConfigTypeInfo<T>::singleton{ODrivePositionCompareConfigTypeInfo<T>::property_table, sizeof(ODrivePositionCompareConfigTypeInfo<T>::property_table) / sizeof(ODrivePositionCompareConfigTypeInfo<T>::property_table[0])};
+
+
 template<typename T>
 const PropertyInfo ODrive3ConfigTypeInfo<T>::property_table[] = {
     {"enable_uart_a", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODrive3Intf::ConfigIntf::get_enable_uart_a(std::declval<T*>()))>>::singleton},
@@ -1881,6 +2400,9 @@ const PropertyInfo ODrive3ConfigTypeInfo<T>::property_table[] = {
     {"error_gpio_pin", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODrive3Intf::ConfigIntf::get_error_gpio_pin(std::declval<T*>()))>>::singleton},
     {"gpio3_analog_mapping", &ODriveEndpointTypeInfo<std::remove_reference_t<decltype(*ODrive3Intf::ConfigIntf::get_gpio3_analog_mapping(std::declval<T*>()))>>::singleton},
     {"gpio4_analog_mapping", &ODriveEndpointTypeInfo<std::remove_reference_t<decltype(*ODrive3Intf::ConfigIntf::get_gpio4_analog_mapping(std::declval<T*>()))>>::singleton},
+    {"kinematics", &ODriveConfigKinematicsTypeInfo<std::remove_reference_t<decltype(*ODrive3Intf::ConfigIntf::get_kinematics(std::declval<T*>()))>>::singleton},
+    {"motion_queue", &ODriveConfigMotionQueueTypeInfo<std::remove_reference_t<decltype(*ODrive3Intf::ConfigIntf::get_motion_queue(std::declval<T*>()))>>::singleton},
+    {"enable_double_pwm_update", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODrive3Intf::ConfigIntf::get_enable_double_pwm_update(std::declval<T*>()))>>::singleton},
     {"gpio1_mode", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODrive3Intf::ConfigIntf::get_gpio1_mode(std::declval<T*>()))>>::singleton},
     {"gpio2_mode", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODrive3Intf::ConfigIntf::get_gpio2_mode(std::declval<T*>()))>>::singleton},
     {"gpio3_mode", &FibrePropertyTypeInfo<std::remove_reference_t<decltype(*ODrive3Intf::ConfigIntf::get_gpio3_mode(std::declval<T*>()))>>::singleton},
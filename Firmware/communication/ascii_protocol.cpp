@@ -1,7 +1,8 @@
 /*
 * The ASCII protocol is a simpler, human readable alternative to the main native
 * protocol.
-* In the future this protocol might be extended to support selected GCode commands.
+* A subset of GCode (G0, G1, G4, G28, G90, G91, M17, M18, M84, M114, M400)
+* is supported and executed from an on-device motion queue.
 * For a list of supported commands see doc/ascii-protocol.md
 */
 
@@ -10,6 +11,7 @@
 #include "odrive_main.h"
 #include "communication.h"
 #include "ascii_protocol.hpp"
+#include "gcode.hpp"
 #include <utils.hpp>
 #include <fibre/cpp_utils.hpp>
 
@@ -24,6 +26,9 @@ using namespace fibre;
 /* Global variables ----------------------------------------------------------*/
 /* Private constant data -----------------------------------------------------*/
 
+// Longest time a GCode line blocks its channel waiting for the motion queue
+static constexpr uint32_t GCODE_WAIT_TIMEOUT_MS = 1000;
+
 #define TO_STR_INNER(s) #s
 #define TO_STR(s) TO_STR_INNER(s)
 
@@ -138,6 +143,10 @@ void AsciiProtocol::process_line(cbufptr_t buffer) {
         case 'c': cmd_set_torque(cmd, use_checksum);                  break;  // current control
         case 't': cmd_set_trapezoid_trajectory(cmd, use_checksum);    break;  // trapezoidal trajectory
         case 'f': cmd_get_feedback(cmd, use_checksum);                break;  // feedback
+        case 'k': cmd_kinematics(cmd, use_checksum);                  break;  // joint space setpoint / feedback
+        case 'G':
+        case 'M':
+        case 'N': cmd_gcode(cmd, use_checksum);                       break;  // GCode subset
         case 'h': cmd_help(cmd, use_checksum);                        break;  // Help
         case 'i': cmd_info_dump(cmd, use_checksum);                   break;  // Dump device info
         case 's': cmd_system_ctrl(cmd, use_checksum);                 break;  // System
@@ -284,6 +293,22 @@ void AsciiProtocol::cmd_set_trapezoid_trajectory(char* pStr, bool use_checksum)
     unsigned motor_number;
     float goal_point;
 
+    /**多轴同步轨迹命令：Format: tc destination0 destination1
+     * 两个轴同时开始、同时结束运动。*/
+    if (pStr[1] == 'c') {
+        std::array<float, AXIS_COUNT> goal_points;
+        static_assert(AXIS_COUNT == 2, "coordinated move command expects two axes");
+        if (sscanf(pStr, "tc %f %f", &goal_points[0], &goal_points[1]) < 2) {
+            respond(use_checksum, "invalid command format");
+        } else if (!odrv.move_to_pos_coordinated(goal_points)) {
+            respond(use_checksum, "all axes must be in closed loop control");
+        } else {
+            for (auto& axis: axes)
+                axis.watchdog_feed();
+        }
+        return;
+    }
+
     if (sscanf(pStr, "t %u %f", &motor_number, &goal_point) < 2) {
         respond(use_checksum, "invalid command format");
     } else if (motor_number >= AXIS_COUNT) {
@@ -317,6 +342,109 @@ void AsciiProtocol::cmd_get_feedback(char * pStr, bool use_checksum) {
     }
 }
 
+// @brief Executes the joint space setpoint and feedback commands
+// @param pStr buffer of ASCII encoded values
+// @param use_checksum bool to indicate whether a checksum is required on response
+void AsciiProtocol::cmd_kinematics(char * pStr, bool use_checksum) {
+    /**运动学变换命令：k j0 j1 [vel0 vel1 [force0 force1]] 设置关节空间目标，
+     * kf 返回关节空间位置和速度估计*/
+    if (pStr[1] == 'f') {
+        respond(use_checksum, "%f %f %f %f",
+                (double)odrv.kinematics_pos_estimate_[0], (double)odrv.kinematics_pos_estimate_[1],
+                (double)odrv.kinematics_vel_estimate_[0], (double)odrv.kinematics_vel_estimate_[1]);
+        return;
+    }
+
+    std::array<float, 2> pos, vel = {}, force = {};
+    int numscan = sscanf(pStr, "k %f %f %f %f %f %f", &pos[0], &pos[1], &vel[0], &vel[1], &force[0], &force[1]);
+    if (numscan < 2 || numscan == 3 || numscan == 5) {
+        respond(use_checksum, "invalid command format");
+    } else if (!odrv.set_kinematics_input(pos, vel, force)) {
+        respond(use_checksum, "kinematics not configured");
+    } else {
+        for (auto& axis: axes)
+            axis.watchdog_feed();
+    }
+}
+
+// @brief Executes a line of the supported GCode subset
+// @param pStr buffer of ASCII encoded values
+// @param use_checksum bool to indicate whether a checksum is required on response
+void AsciiProtocol::cmd_gcode(char * pStr, bool use_checksum) {
+    /**G-code 子集：G0/G1 直线运动（F 为每分钟进给量），G4 暂停，G28 回零，
+     * G90/G91 绝对/相对坐标，M17/M18/M84 使能/失能，M114 报告位置，M400 等待队列执行完毕。
+     * 运动指令进入运动队列，由控制回路连续执行。一行的所有指令要么全部入队，要么都不入队。
+     * 队列满时最多等待 GCODE_WAIT_TIMEOUT_MS，有空位才回复 "ok"，发送端据此进行流控；
+     * 超时则回复 "busy"，这一行没有执行，发送端应重发。M400 同样最多等待这么久。*/
+    GCodeLine line;
+    if (!line.parse(pStr)) {
+        respond(use_checksum, "invalid command format");
+        return;
+    }
+
+    MotionQueue& queue = odrv.motion_queue_;
+
+    // Homing runs per motor. With a kinematic transform a single motor moves
+    // a combination of joints, so that would not home the joints.
+    if (odrv.kinematics_.enabled()) {
+        for (size_t i = 0; i < line.num_g_codes; ++i) {
+            if (line.g_codes[i] == 28) {
+                respond(use_checksum, "G28 not supported with kinematics");
+                return;
+            }
+        }
+    }
+
+    // Moves start from the current setpoint if nothing is queued
+    MotionQueue::GCodeState_t state = queue.gcode_;
+    if (!queue.busy()) {
+        state.planned_pos = queue.get_setpoint();
+    }
+
+    MotionQueue::Command_t commands[MotionQueue::MAX_LINE_COMMANDS];
+    size_t num_commands = 0;
+    int code = 0;
+    switch (MotionQueue::translate(line, state, odrv.config_.motion_queue.rapid_rate, commands, &num_commands, &code)) {
+        case MotionQueue::GCODE_OK: break;
+        case MotionQueue::GCODE_NO_COMMAND: respond(use_checksum, "missing G or M word"); return;
+        case MotionQueue::GCODE_UNSUPPORTED_G: respond(use_checksum, "unsupported G%d", code); return;
+        case MotionQueue::GCODE_UNSUPPORTED_M: respond(use_checksum, "unsupported M%d", code); return;
+        case MotionQueue::GCODE_INVALID_FEED_RATE: respond(use_checksum, "invalid feed rate"); return;
+    }
+
+    for (uint32_t waited = 0; !queue.push(commands, num_commands); ++waited) {
+        if (waited >= GCODE_WAIT_TIMEOUT_MS) {
+            respond(use_checksum, "busy");
+            return;
+        }
+        osDelay(1);
+    }
+    queue.gcode_ = state;
+
+    if (line.has('M')) {
+        switch ((int)line.get('M', 0.0f)) {
+            case 114: {
+                std::array<float, 2> pos = queue.get_setpoint();
+                respond(use_checksum, "X:%f Y:%f", (double)pos[0], (double)pos[1]);
+            } break;
+            case 400: {
+                for (uint32_t waited = 0; queue.busy(); ++waited) {
+                    if (waited >= GCODE_WAIT_TIMEOUT_MS) {
+                        respond(use_checksum, "busy");
+                        return;
+                    }
+                    osDelay(1);
+                }
+            } break;
+            default: break;
+        }
+    }
+
+    for (auto& axis: axes)
+        axis.watchdog_feed();
+    respond(use_checksum, "ok");
+}
+
 // @brief Shows help text
 // @param pStr buffer of ASCII encoded values
 // @param response_channel reference to the stream to respond on
@@ -328,6 +456,10 @@ void AsciiProtocol::cmd_help(char * pStr, bool use_checksum) {
     respond(use_checksum, "Available commands syntax reference:");
     respond(use_checksum, "Position: q axis pos vel-lim I-lim");
     respond(use_checksum, "Position: p axis pos vel-ff I-ff");
+    respond(use_checksum, "Coordinated trajectory: tc pos0 pos1");
+    respond(use_checksum, "Joint space: k pos0 pos1 vel-ff0 vel-ff1 F-ff0 F-ff1");
+    respond(use_checksum, "Joint space feedback: kf");
+    respond(use_checksum, "GCode: G0/G1 X Y F, G4 P/S, G28, G90, G91, M17, M18, M84, M114, M400");
     respond(use_checksum, "Velocity: v axis vel I-ff");
     respond(use_checksum, "Torque: c axis T");
     respond(use_checksum, "");
@@ -20,6 +20,8 @@ private:
     void cmd_set_torque(char * pStr, bool use_checksum);
     void cmd_set_trapezoid_trajectory(char * pStr, bool use_checksum);
     void cmd_get_feedback(char * pStr, bool use_checksum);
+    void cmd_kinematics(char * pStr, bool use_checksum);
+    void cmd_gcode(char * pStr, bool use_checksum);
     void cmd_help(char * pStr, bool use_checksum);
     void cmd_info_dump(char * pStr, bool use_checksum);
     void cmd_system_ctrl(char * pStr, bool use_checksum);
@@ -158,6 +158,9 @@ void CANSimple::do_command(Axis& axis, const can_Message_t& msg) {
         case MSG_GET_CONTROLLER_ERROR:
             get_controller_error_callback(axis);
             break;
+        case MSG_SET_CAM_MASTER:
+            set_cam_master_callback(axis, msg);
+            break;
         default:
             break;
     }
@@ -278,6 +281,11 @@ void CANSimple::set_input_pos_callback(Axis& axis, const can_Message_t& msg) {
     axis.controller_.input_pos_updated();
 }
 
+void CANSimple::set_cam_master_callback(Axis& axis, const can_Message_t& msg) {
+    axis.controller_.set_cam_master(can_getSignal<float>(msg, 0, 32, true),
+                                    can_getSignal<float>(msg, 32, 32, true));
+}
+
 void CANSimple::set_input_vel_callback(Axis& axis, const can_Message_t& msg) {
     axis.controller_.input_vel_ = can_getSignal<float>(msg, 0, 32, true);
     axis.controller_.input_torque_ = can_getSignal<float>(msg, 32, 32, true);
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+// Words of one G-code line, e.g. "N10 G91 G1 X1.5 Y-2 F600".
+// Letters are case insensitive. Several G words may appear on one line, all
+// other letters keep the last value given.
+struct GCodeLine {
+    static constexpr size_t MAX_G_CODES = 4;
+
+    float values[26] = {};
+    uint32_t present = 0;  // bit i set if letter 'A' + i was given
+    int g_codes[MAX_G_CODES] = {};
+    size_t num_g_codes = 0;
+
+    bool has(char letter) const {
+        return present & (1u << (letter - 'A'));
+    }
+
+    float get(char letter, float fallback) const {
+        return has(letter) ? values[letter - 'A'] : fallback;
+    }
+
+    // Returns false on a syntax error (a letter without a number, an unknown
+    // character or too many G words).
+    bool parse(const char* str) {
+        present = 0;
+        num_g_codes = 0;
+        while (*str) {
+            if (std::isspace((unsigned char)*str)) {
+                ++str;
+                continue;
+            }
+            char letter = (char)std::toupper((unsigned char)*str);
+            if (letter < 'A' || letter > 'Z') {
+                return false;
+            }
+            char* end;
+            float value = std::strtof(str + 1, &end);
+            if (end == str + 1) {
+                return false;
+            }
+            str = end;
+
+            if (letter == 'G') {
+                if (num_g_codes >= MAX_G_CODES) {
+                    return false;
+                }
+                g_codes[num_g_codes++] = (int)value;
+            }
+            values[letter - 'A'] = value;
+            present |= 1u << (letter - 'A');
+        }
+        return true;
+    }
+};